@@ -0,0 +1,301 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "ps2_keyboard_state.h"
+#ifdef __x86_64__
+# include <x86intrin.h>
+#endif
+
+/*
+  Throughput of the scan code path, for judging changes of the lookup structures.
+  usage: bench_decoder [-b <baseline>] [-s 1|2|3 -f <capture>]...
+  Every stream is decoded the way keyboard_decode() does, byte per byte through ps2_add_to_pending_code(),
+  then ps2_find_scan_key_code() and ps2_key_name_with_modifiers() on each completed code.
+  The `probe` streams only run ps2_maybe_in_scan_set() over each byte, from the root of the automaton.
+  The synthetic streams are made of the pressed and released codes of each kind of key of the set,
+  the short make codes of the sets with a break prefix being followed by their break codes,
+  <capture> is a file of raw bytes from the keyboard, as replayed by ps2_replay.
+  Each stream is timed BENCH_RUNS times, the best run is reported in ns/byte, ns/event and cycles/event,
+  the cycles being the ones of the TSC. With a baseline, as printed by a previous run, the change of ns/event is printed.
+ */
+
+#define BENCH_STREAM_BYTES (1UL << 22)
+#define BENCH_RUNS 5U
+#define BENCH_MAX_CAPTURES 8U
+
+struct	bench_stream {
+	char				name[32];
+	const struct scan_code_set	*set;
+	uint8_t				*bytes;
+	size_t				size;
+	bool				probe;
+};
+
+struct	bench_result {
+	double		ns_per_byte;
+	double		ns_per_event;
+	double		cycles_per_event;
+	uint64_t	events;
+};
+
+static uint64_t	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint64_t	now_cycles(void)
+{
+#ifdef __x86_64__
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+static bool	is_kind(const struct scan_key_code *key, const char *kind)
+{
+	uint8_t	len = scan_key_code_len(key->code);
+
+	if (!strcmp(kind, "single"))
+		return len == 1;
+	if (!strcmp(kind, "extended"))
+		return len == 2 && (key->code >> 8U) == 0xE0;
+	if (!strcmp(kind, "print_screen"))
+		return len == 4 && (key->code >> 24U) == 0xE0;
+	if (!strcmp(kind, "pause"))
+		return len > 4 && (key->code >> ((len - 1U) * 8U)) == 0xE1;
+	return true;
+}
+
+/*
+  Stream of BENCH_STREAM_BYTES bytes of random codes of `kind`, or of any kind for "mixed"
+ */
+static bool	build_stream(struct bench_stream *stream, const struct scan_code_set *set, unsigned int set_number,
+			     const char *kind)
+{
+	const struct scan_key_code	*keys[512];
+	unsigned int			keys_len = 0;
+	const struct scan_key_code	*key;
+	unsigned int			seed = 42;
+	uint64_t			code;
+	uint8_t				len;
+	uint64_t			i;
+
+	for (i = 0; i < set->len && keys_len < sizeof(keys) / sizeof(*keys); i++) {
+		if (is_kind(&set->keys[i], kind))
+			keys[keys_len++] = &set->keys[i];
+	}
+	if (keys_len == 0)
+		return false;
+	snprintf(stream->name, sizeof(stream->name), "set%u/%s", set_number, kind);
+	stream->set = set;
+	stream->probe = false;
+	stream->bytes = malloc(BENCH_STREAM_BYTES);
+	stream->size = 0;
+	if (stream->bytes == NULL)
+		return false;
+	while (true) {
+		key = keys[rand_r(&seed) % keys_len];
+		code = key->code;
+		len = scan_key_code_len(code);
+		if (stream->size + 2U * len + 1U > BENCH_STREAM_BYTES)
+			break;
+		while (len-- != 0)
+			stream->bytes[stream->size++] = code >> (len * 8U);
+		len = scan_key_code_len(code);
+		if (set->break_prefix == 0 || len > 2)
+			continue;
+		// The break code, with the prefix before the last byte
+		while (len-- != 1)
+			stream->bytes[stream->size++] = code >> (len * 8U);
+		stream->bytes[stream->size++] = set->break_prefix;
+		stream->bytes[stream->size++] = code;
+	}
+	return true;
+}
+
+static bool	load_capture(struct bench_stream *stream, const struct scan_code_set *set, unsigned int set_number,
+			     const char *path)
+{
+	struct stat	st;
+	ssize_t		ret;
+	int		fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0 || fstat(fd, &st) < 0 || st.st_size == 0) {
+		perror(path);
+		return false;
+	}
+	snprintf(stream->name, sizeof(stream->name), "set%u/%s", set_number, strrchr(path, '/') ? strrchr(path, '/') + 1 : path);
+	stream->set = set;
+	stream->probe = false;
+	stream->size = st.st_size;
+	stream->bytes = malloc(stream->size);
+	ret = stream->bytes ? read(fd, stream->bytes, stream->size) : -1;
+	close(fd);
+	return ret == (ssize_t)stream->size;
+}
+
+/*
+  Same calls as keyboard_decode(), returns the number of key events
+ */
+static uint64_t	decode_stream(const struct bench_stream *stream, struct ps2_keyboard_state *state)
+{
+	const struct scan_key_code	*key;
+	uint64_t			events = 0;
+	volatile char			sink;
+	size_t				i;
+
+	for (i = 0; i < stream->size; i++) {
+		if (!ps2_add_to_pending_code(state, stream->bytes[i])) {
+			ps2_reset_pending_code(state);
+			continue;
+		}
+		key = ps2_find_scan_key_code(state);
+		if (key == NULL)
+			continue;
+		sink = ps2_key_name_with_modifiers(state, key);
+		(void)sink;
+		ps2_reset_pending_code(state);
+		events++;
+	}
+	return events;
+}
+
+static uint64_t	probe_stream(const struct bench_stream *stream, struct ps2_keyboard_state *state)
+{
+	uint64_t	hits = 0;
+	size_t		i;
+
+	for (i = 0; i < stream->size; i++)
+		hits += ps2_maybe_in_scan_set(state, stream->bytes[i]);
+	return hits;
+}
+
+static void	run_stream(const struct bench_stream *stream, struct bench_result *result)
+{
+	struct ps2_keyboard_state	state;
+	uint64_t			best_ns = ~0ULL;
+	uint64_t			best_cycles = 0;
+	uint64_t			start_ns;
+	uint64_t			start_cycles;
+	uint64_t			cycles;
+	uint64_t			ns;
+	unsigned int			run;
+
+	for (run = 0; run < BENCH_RUNS; run++) {
+		memset(&state, 0, sizeof(state));
+		state.scan_code_set = stream->set;
+		ps2_reset_pending_code(&state);
+		start_ns = now_ns();
+		start_cycles = now_cycles();
+		if (stream->probe)
+			result->events = probe_stream(stream, &state);
+		else
+			result->events = decode_stream(stream, &state);
+		cycles = now_cycles() - start_cycles;
+		ns = now_ns() - start_ns;
+		if (ns < best_ns) {
+			best_ns = ns;
+			best_cycles = cycles;
+		}
+	}
+	result->ns_per_byte = (double)best_ns / stream->size;
+	result->ns_per_event = result->events ? (double)best_ns / result->events : 0;
+	result->cycles_per_event = result->events ? (double)best_cycles / result->events : 0;
+}
+
+/*
+  ns/event of `name` in a baseline file, 0 if it is not there
+ */
+static double	baseline_ns_per_event(const char *path, const char *name)
+{
+	char	line[256];
+	char	line_name[64];
+	double	ns_per_byte;
+	double	ns_per_event;
+	double	found = 0;
+	FILE	*file;
+
+	if (path == NULL || NULL == (file = fopen(path, "r")))
+		return 0;
+	while (fgets(line, sizeof(line), file)) {
+		if (sscanf(line, "%63s %lf %lf", line_name, &ns_per_byte, &ns_per_event) == 3
+			&& !strcmp(line_name, name))
+			found = ns_per_event;
+	}
+	fclose(file);
+	return found;
+}
+
+static void	usage(const char *name)
+{
+	fprintf(stderr, "usage: %s [-b <baseline>] [-s 1|2|3 -f <capture>]...\n", name);
+	exit(EXIT_FAILURE);
+}
+
+int	main(int argc, char **argv)
+{
+	static const char *const	kinds[] = { "single", "extended", "print_screen", "pause", "mixed" };
+	const struct scan_code_set	*sets[] = { &scan_code_set_1, &scan_code_set_2, &scan_code_set_3 };
+	struct bench_stream		streams[3 * (sizeof(kinds) / sizeof(*kinds) + 1) + BENCH_MAX_CAPTURES];
+	unsigned int			streams_len = 0;
+	struct bench_result		result;
+	const char			*baseline = NULL;
+	unsigned int			set_number = 1;
+	unsigned int			s;
+	unsigned int			k;
+	double				base;
+	int				opt;
+
+	while ((opt = getopt(argc, argv, "b:s:f:")) != -1) {
+		switch (opt) {
+		case 'b':
+			baseline = optarg;
+			break;
+		case 's':
+			set_number = strtoul(optarg, NULL, 0);
+			if (set_number == 0 || set_number > sizeof(sets) / sizeof(*sets))
+				usage(argv[0]);
+			break;
+		case 'f':
+			if (streams_len == BENCH_MAX_CAPTURES
+				|| !load_capture(&streams[streams_len++], sets[set_number - 1], set_number, optarg))
+				return EXIT_FAILURE;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	for (s = 0; s < sizeof(sets) / sizeof(*sets); s++) {
+		for (k = 0; k < sizeof(kinds) / sizeof(*kinds); k++) {
+			if (build_stream(&streams[streams_len], sets[s], s + 1, kinds[k]))
+				streams_len++;
+		}
+		// The mixed stream again, through ps2_maybe_in_scan_set()
+		streams[streams_len] = streams[streams_len - 1];
+		snprintf(streams[streams_len].name, sizeof(streams[streams_len].name), "set%u/probe", s + 1);
+		streams[streams_len++].probe = true;
+	}
+
+	printf("%-24s %10s %10s %12s %10s\n", "# stream", "ns/byte", "ns/event", "cycles/event", "vs base");
+	for (s = 0; s < streams_len; s++) {
+		run_stream(&streams[s], &result);
+		printf("%-24s %10.2f %10.2f %12.1f", streams[s].name, result.ns_per_byte, result.ns_per_event,
+			result.cycles_per_event);
+		base = baseline_ns_per_event(baseline, streams[s].name);
+		if (base != 0)
+			printf(" %+9.1f%%", (result.ns_per_event - base) * 100 / base);
+		printf("\n");
+	}
+	for (s = 0; s < streams_len; s++) {
+		if (!streams[s].probe)
+			free(streams[s].bytes);
+	}
+	return EXIT_SUCCESS;
+}
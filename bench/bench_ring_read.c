@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <time.h>
+#include "key_entry_ring.h"
+
+/*
+  Resuming a read must cost the same however large the backlog is.
+  For each backlog size, fills a ring with that many entries and drains it the way the driver does:
+  by read() sized chunks of records copied straight from the ring in binary mode,
+  and one record at a time through key_entry_ring_read() in text mode.
+  The cost of the first and of the last chunks of the drain are reported apart,
+  with a reader which resumes from a sequence number they must be the same.
+ */
+
+#define BENCH_CHUNK_RECORDS 64U
+#define BENCH_SAMPLE_CHUNKS 256U
+
+static const unsigned long  backlogs[] = {
+	1UL << 10,
+	1UL << 14,
+	1UL << 18,
+	1UL << 20,
+	1UL << 22,
+};
+
+static uint64_t	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void	fill(struct key_entry_ring *ring, unsigned long backlog)
+{
+	struct keyboard_driver_record	record;
+	unsigned long			i;
+
+	memset(&record, 0, sizeof(record));
+	for (i = 0; i < backlog; i++) {
+		record.timestamp = i;
+		record.key_id = i;
+		key_entry_ring_push(ring, &record);
+	}
+}
+
+/*
+  Same loop as driver_read_records(), minus copy_to_user()
+ */
+static uint64_t	read_chunk(struct key_entry_ring *ring, struct key_entry_cursor *cursor,
+			   struct keyboard_driver_record *buf, uint64_t count)
+{
+	uint64_t    copied = 0;
+	uint64_t    n;
+
+	key_entry_ring_catch_up(ring, cursor);
+	while (0 != (n = min_t(uint64_t, key_entry_ring_contiguous(ring, cursor->seq), count - copied))) {
+		memcpy(buf + copied, key_entry_ring_peek(ring, cursor->seq), n * sizeof(*buf));
+		if (key_entry_ring_catch_up(ring, cursor) != 0)
+			continue;
+		copied += n;
+		cursor->seq += n;
+	}
+	return copied;
+}
+
+static uint64_t	read_chunk_text(struct key_entry_ring *ring, struct key_entry_cursor *cursor,
+				struct keyboard_driver_record *buf, uint64_t count)
+{
+	uint64_t    copied = 0;
+
+	while (copied < count && key_entry_ring_read(ring, cursor, &buf[copied]))
+		copied++;
+	return copied;
+}
+
+typedef uint64_t (*read_chunk_t)(struct key_entry_ring *, struct key_entry_cursor *,
+				 struct keyboard_driver_record *, uint64_t);
+
+/*
+  Drains the ring by chunks, returns the mean cost in ns of the first and last BENCH_SAMPLE_CHUNKS chunks
+ */
+static void	drain(struct key_entry_ring *ring, unsigned long backlog, read_chunk_t read_chunk,
+		      double *first, double *last)
+{
+	static struct keyboard_driver_record	buf[BENCH_CHUNK_RECORDS];
+	struct key_entry_cursor			cursor = { 0, 0 };
+	uint64_t				chunks = backlog / BENCH_CHUNK_RECORDS;
+	uint64_t				samples = min_t(uint64_t, chunks / 2, BENCH_SAMPLE_CHUNKS);
+	uint64_t				first_ns = 0;
+	uint64_t				last_ns = 0;
+	uint64_t				start;
+	uint64_t				i;
+
+	for (i = 0; i < chunks; i++) {
+		start = now_ns();
+		if (read_chunk(ring, &cursor, buf, BENCH_CHUNK_RECORDS) != BENCH_CHUNK_RECORDS) {
+			fprintf(stderr, "Short read at chunk %lu\n", (unsigned long)i);
+			exit(EXIT_FAILURE);
+		}
+		if (i < samples)
+			first_ns += now_ns() - start;
+		else if (i >= chunks - samples)
+			last_ns += now_ns() - start;
+	}
+	*first = (double)first_ns / samples;
+	*last = (double)last_ns / samples;
+}
+
+int	main(void)
+{
+	struct key_entry_ring	ring;
+	double			first;
+	double			last;
+	double			text_first;
+	double			text_last;
+	unsigned long		i;
+
+	printf("%10s %12s %12s %12s %12s   (ns per chunk of %u records)\n",
+		"backlog", "bin first", "bin last", "text first", "text last", BENCH_CHUNK_RECORDS);
+	for (i = 0; i < sizeof(backlogs) / sizeof(*backlogs); i++) {
+		if (key_entry_ring_init(&ring, backlogs[i], backlogs[i], KEY_ENTRY_RING_DROP_OLDEST)) {
+			fprintf(stderr, "Failed to allocate a ring of %lu entries\n", backlogs[i]);
+			return EXIT_FAILURE;
+		}
+		fill(&ring, backlogs[i]);
+		drain(&ring, backlogs[i], &read_chunk, &first, &last);
+		drain(&ring, backlogs[i], &read_chunk_text, &text_first, &text_last);
+		printf("%10lu %12.1f %12.1f %12.1f %12.1f\n", backlogs[i], first, last, text_first, text_last);
+		key_entry_ring_destroy(&ring);
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,172 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <time.h>
+#include "key_entry_text.h"
+
+/*
+  Cost of the text mode, per record and per byte, for a bulk read of BENCH_RECORDS records by pages:
+  - printf: the former seq_file path, the date divided into hours, minutes and seconds
+    and the line rendered by snprintf() for each record, as driver_seq_show() did with seq_printf()
+  - formatter: key_entry_text_format(), as driver_read_text() does
+  - memcpy: the same text copied page per page, the bound for both
+  Each is timed BENCH_RUNS times, the best run is reported.
+ */
+
+#define BENCH_RECORDS (1UL << 20)
+#define BENCH_RUNS 5U
+#define BENCH_PAGE_SIZE 4096U
+
+static char	page[BENCH_PAGE_SIZE];
+static char	*out;
+
+static uint64_t	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+  Typing at about 12 key events per second, over the keys of set 1
+ */
+static void	build_records(struct keyboard_driver_record *records)
+{
+	unsigned int	seed = 42;
+	uint64_t	timestamp = 3600ULL * NSEC_PER_SEC;
+	uint64_t	i;
+
+	memset(records, 0, BENCH_RECORDS * sizeof(*records));
+	for (i = 0; i < BENCH_RECORDS; i++) {
+		const struct scan_key_code	*key = &scan_code_set_1.keys[rand_r(&seed) % scan_code_set_1.len];
+
+		timestamp += 40000000ULL + rand_r(&seed) % 80000000ULL;
+		records[i].timestamp = timestamp;
+		records[i].code = key->code;
+		records[i].key_id = key->id;
+		records[i].state = key->state;
+	}
+}
+
+static size_t	render_printf(const struct keyboard_driver_record *records, uint64_t realtime_offset)
+{
+	const struct keyboard_driver_record	*record;
+	const char				*key_name;
+	long long				date;
+	size_t					len = 0;
+	size_t					total = 0;
+	int					n;
+	uint64_t				i;
+
+	for (i = 0; i < BENCH_RECORDS; i++) {
+		record = &records[i];
+		date = (record->timestamp + realtime_offset) / NSEC_PER_SEC;
+		key_name = scan_code_key_names[record->key_id];
+		n = snprintf(page + len, sizeof(page) - len, "%02lld:%02lld:%02lld %s(%#02llx) %s\n",
+			     (date / 3600) % 24, (date / 60) % 60, date % 60,
+			     key_name ? key_name : "unknown", record->code,
+			     record->state == RELEASED ? "Released" : "Pressed");
+		if ((size_t)n >= sizeof(page) - len) {
+			memcpy(out + total, page, len);
+			total += len;
+			len = 0;
+			i--;
+			continue;
+		}
+		len += n;
+	}
+	memcpy(out + total, page, len);
+	return total + len;
+}
+
+static size_t	render_formatter(const struct keyboard_driver_record *records, uint64_t realtime_offset)
+{
+	struct key_entry_text	text;
+	size_t			len = 0;
+	size_t			total = 0;
+	uint64_t		i;
+
+	key_entry_text_init(&text, realtime_offset);
+	for (i = 0; i < BENCH_RECORDS; i++) {
+		if (len + KEY_ENTRY_TEXT_MAX_LINE > sizeof(page)) {
+			memcpy(out + total, page, len);
+			total += len;
+			len = 0;
+		}
+		len += key_entry_text_format(&text, &records[i], page + len);
+	}
+	memcpy(out + total, page, len);
+	return total + len;
+}
+
+static char	*reference;
+static size_t	reference_size;
+
+static size_t	render_memcpy(const struct keyboard_driver_record *records, uint64_t realtime_offset)
+{
+	size_t	total;
+
+	(void)records;
+	(void)realtime_offset;
+	for (total = 0; total < reference_size; total += BENCH_PAGE_SIZE) {
+		memcpy(page, reference + total, min_t(size_t, BENCH_PAGE_SIZE, reference_size - total));
+		memcpy(out + total, page, min_t(size_t, BENCH_PAGE_SIZE, reference_size - total));
+	}
+	return reference_size;
+}
+
+typedef size_t (*render_t)(const struct keyboard_driver_record *, uint64_t);
+
+static uint64_t	best_ns(render_t render, const struct keyboard_driver_record *records, size_t *size)
+{
+	uint64_t	best = ~0ULL;
+	uint64_t	start;
+	unsigned int	run;
+
+	for (run = 0; run < BENCH_RUNS; run++) {
+		start = now_ns();
+		*size = render(records, 1700000000ULL * NSEC_PER_SEC);
+		best = min_t(uint64_t, best, now_ns() - start);
+	}
+	return best;
+}
+
+int	main(void)
+{
+	static const struct {
+		const char	*name;
+		render_t	render;
+	}	paths[] = {
+		{ "printf", &render_printf },
+		{ "formatter", &render_formatter },
+		{ "memcpy", &render_memcpy },
+	};
+	struct keyboard_driver_record	*records;
+	size_t				size;
+	uint64_t			ns;
+	unsigned int			i;
+
+	key_entry_text_setup();
+	records = malloc(BENCH_RECORDS * sizeof(*records));
+	out = malloc(BENCH_RECORDS * KEY_ENTRY_TEXT_MAX_LINE);
+	reference = malloc(BENCH_RECORDS * KEY_ENTRY_TEXT_MAX_LINE);
+	if (records == NULL || out == NULL || reference == NULL)
+		return EXIT_FAILURE;
+	build_records(records);
+	reference_size = render_printf(records, 1700000000ULL * NSEC_PER_SEC);
+	memcpy(reference, out, reference_size);
+
+	printf("%-12s %10s %10s %10s\n", "# path", "ns/record", "ns/byte", "MB/s");
+	for (i = 0; i < sizeof(paths) / sizeof(*paths); i++) {
+		ns = best_ns(paths[i].render, records, &size);
+		if (size != reference_size || memcmp(out, reference, size)) {
+			fprintf(stderr, "%s: the text differs from the one of printf\n", paths[i].name);
+			return EXIT_FAILURE;
+		}
+		printf("%-12s %10.2f %10.3f %10.0f\n", paths[i].name, (double)ns / BENCH_RECORDS,
+			(double)ns / size, (double)size * 1000 / ns);
+	}
+	free(records);
+	free(out);
+	free(reference);
+	return EXIT_SUCCESS;
+}
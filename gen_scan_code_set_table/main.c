@@ -22,6 +22,20 @@
 
 # define IN_BUFFER_SIZE 4096 * 10
 
+# define MAX_KEYS 1024
+# define MAX_NAMES_POOL_SIZE 4096 * 4
+
+/*
+  These must match the definitions of scan_code_sets.h
+ */
+# define SCAN_CODE_MAX_KEY_IDS 256U
+# define SCAN_CODE_INDEX_MAX_LONG_CODES 8U
+# define SCAN_CODE_AUTOMATON_MAX_STATES 16U
+# define SCAN_CODE_TRANSITION_INVALID 0x0U
+# define SCAN_CODE_TRANSITION_ACCEPT 0x8000U
+
+# define NO_KEY -1
+
 enum	key_state {
 	PRESSED,
 	RELEASED
@@ -31,6 +45,63 @@ struct scan_key_code {
 	uint64_t	code;
 	char	        *key_name;
 	enum key_state	state;
+
+	// C character literal of the ascii value, if any, else NULL
+	char		*ascii_value;
+
+	// Offset of `key_name` in the names pool
+	uint64_t	name_offset;
+
+	// Identifier of the physical key, that is of its name
+	uint64_t	id;
+
+	const char	*modifier;
+};
+
+struct scan_code_set {
+	char			*name;
+	char			*path;
+	struct scan_key_code	keys[MAX_KEYS];
+	uint64_t		len;
+
+	int64_t			single[256];
+	int64_t			extended[2][256];
+	int64_t			long_codes[SCAN_CODE_INDEX_MAX_LONG_CODES];
+	uint8_t			long_codes_len;
+
+	uint16_t		transitions[SCAN_CODE_AUTOMATON_MAX_STATES][256];
+	uint8_t			states_len;
+
+	// Byte announcing the break code of a key, 0 if every break code is in the table
+	uint8_t			break_prefix;
+};
+
+/*
+  Key names shared by every set, each one is stored once, NUL terminated
+ */
+static char	names_pool[MAX_NAMES_POOL_SIZE];
+static uint64_t	names_pool_len = 0;
+
+/*
+  Offset in the names pool of each key id
+ */
+static uint64_t	names_offsets[SCAN_CODE_MAX_KEY_IDS];
+static uint64_t	key_ids_len = 0;
+
+static const struct {
+	const char  *key_name;
+	const char  *modifier;
+} modifiers[] = {
+	{ "escape", "PS2_MODIFIER_ESCAPE" },
+	{ "left control", "PS2_MODIFIER_LEFT_CONTROL" },
+	{ "right control", "PS2_MODIFIER_RIGHT_CONTROL" },
+	{ "left shift", "PS2_MODIFIER_LEFT_SHIFT" },
+	{ "right shift", "PS2_MODIFIER_RIGHT_SHIFT" },
+	{ "CapsLock", "PS2_MODIFIER_CAPSLOCK" },
+	{ "NumberLock", "PS2_MODIFIER_NUMBER_LOCK" },
+	{ "ScrollLock", "PS2_MODIFIER_SCROLL_LOCK" },
+	{ "left alt", "PS2_MODIFIER_LEFT_ALT" },
+	{ "right alt (or altGr)", "PS2_MODIFIER_RIGHT_ALT" },
 };
 
 char	*concat(char *s1, char *s2, char *s3)
@@ -52,90 +123,425 @@ char	*concat(char *s1, char *s2, char *s3)
 	return str;
 }
 
-char	 *str_toupper(char *str)
+static uint8_t	code_len(uint64_t code)
 {
-	char	*tmp = str;
-	while ((*str = (toupper(*str))))
-		str++;
+	uint8_t	    len = 1;
 
-	return tmp;
+	while (len < sizeof(uint64_t) && (code >> (len * 8U)) != 0)
+		len++;
+	return len;
 }
 
-int main(int argc, char **argv)
+static uint8_t	code_byte(uint64_t code, uint8_t n)
 {
-	char	*in_buffer;
-	int	fd;
+	return (code >> ((code_len(code) - n - 1U) * 8U)) & 0xFF;
+}
 
-	if (argc != 2) {
-		ERR("Invalid usage of %s\n", argv[0]);
-		return EXIT_FAILURE;
+/*
+  Returns the key id of `name`, adding it to the names pool if needed
+ */
+static uint64_t	add_to_names_pool(char *name)
+{
+	uint64_t    id = 0;
+	uint64_t    len = strlen(name);
+
+	while (id < key_ids_len) {
+		if (!strcmp(names_pool + names_offsets[id], name))
+			return id;
+		id++;
 	}
-	ERR_SYS_GEN((fd = open(argv[1], O_RDONLY)), return EXIT_FAILURE);
+	assert(key_ids_len < SCAN_CODE_MAX_KEY_IDS);
+	assert(names_pool_len + len + 1 < MAX_NAMES_POOL_SIZE);
+	memcpy(names_pool + names_pool_len, name, len + 1);
+	names_offsets[key_ids_len] = names_pool_len;
+	names_pool_len += len + 1;
+	return key_ids_len++;
+}
+
+static const char	*find_modifier(char *key_name)
+{
+	uint64_t    i = 0;
+
+	while (i < sizeof(modifiers) / sizeof(*modifiers)) {
+		if (!strcmp(modifiers[i].key_name, key_name))
+			return modifiers[i].modifier;
+		i++;
+	}
+	return "PS2_MODIFIER_NONE";
+}
+
+static char	*read_file(char *path)
+{
+	char	    *in_buffer;
+	int	    fd;
+	ssize_t	    ret;
+	uint64_t    count = 0;
+
+	ERR_SYS_GEN((fd = open(path, O_RDONLY)), exit(EXIT_FAILURE));
 
 	if (NULL == (in_buffer = malloc(IN_BUFFER_SIZE))) { // like if I had the time to code proper memory management...
 		ERR("Malloc failure\n");
-		return EXIT_FAILURE;
+		exit(EXIT_FAILURE);
 	}
 	memset(in_buffer, 0, IN_BUFFER_SIZE);
-	ssize_t	    ret;
-	uint64_t    count = 0;
-	while (0 < (ret = read(fd, in_buffer + count, IN_BUFFER_SIZE))) {
+	while (0 < (ret = read(fd, in_buffer + count, IN_BUFFER_SIZE - count))) {
 		count += (uint64_t)ret;
 		assert(count < IN_BUFFER_SIZE);
 	}
 	in_buffer[count] = 0;
-//	uint64_t    i = 0;
-	char	    *current_token = NULL;
-	uint64_t    state = 0;
-	bool	    once = false;
-
-	uint64_t    code;
-	char	    *current_name;
-	char	    *current_status;
-
-	while ((current_token = strtok(!once ? in_buffer : NULL, " \t\b\v\a\n"))) {
-		once = true;
-		switch (state) {
-		case 0: //code
-			sscanf(current_token, "%lx", &code);
-			while (current_token[strlen(current_token) - 1] == ',') {
-				current_token = strtok(!once ? in_buffer : NULL, " \t\b\v\a\n");
-				code <<= 8;
-				uint64_t    plus_code;
-				sscanf(current_token, "%lx", &plus_code);
-				code |= plus_code;
-			}
-//			printf("%#02lx ", code);
-			state++;
-			break;
-		case 1: //name
-			sscanf(current_token, "%ms", &current_name);
-//			printf("%s ", current_name);
+	close(fd);
+	return in_buffer;
+}
+
+/*
+  Each line of a scan code set table is:
+  <code byte>[, <code byte>...] <key name> <pressed|released> [<C character literal of the ascii value>]
+ */
+static void	parse_line(struct scan_code_set *set, char *line, uint64_t line_number)
+{
+	struct scan_key_code	*key;
+	char			*current_token;
+	char			*save;
+	uint64_t		plus_code;
+
+	assert(set->len < MAX_KEYS);
+	key = &set->keys[set->len];
+	memset(key, 0, sizeof(*key));
 
-			state++;
+	current_token = strtok_r(line, " \t", &save);
+	sscanf(current_token, "%lx", &key->code);
+	while (current_token[strlen(current_token) - 1] == ',') {
+		if (NULL == (current_token = strtok_r(NULL, " \t", &save))) {
+			ERR("%s:%lu: Truncated code", set->path, line_number);
+			exit(EXIT_FAILURE);
+		}
+		key->code <<= 8;
+		sscanf(current_token, "%lx", &plus_code);
+		key->code |= plus_code;
+	}
+
+	while ((current_token = strtok_r(NULL, " \t", &save))) {
+		if (!strcmp("pressed", current_token) || !strcmp("released", current_token))
 			break;
+		if (key->key_name == NULL) {
+			sscanf(current_token, "%ms", &key->key_name);
+		} else {
+			char *tmp = key->key_name;
+			key->key_name = concat(key->key_name, " ", current_token);
+			free(tmp);
+		}
+	}
+	if (current_token == NULL || key->key_name == NULL) {
+		ERR("%s:%lu: Missing key name or state", set->path, line_number);
+		exit(EXIT_FAILURE);
+	}
+	key->state = !strcmp("pressed", current_token) ? PRESSED : RELEASED;
+
+	// The ascii literal may hold spaces, so it is whatever remains of the line
+	if (save != NULL) {
+		while (*save == ' ' || *save == '\t')
+			save++;
+		if (*save != '\0')
+			key->ascii_value = strdup(save);
+	}
+	key->id = add_to_names_pool(key->key_name);
+	key->name_offset = names_offsets[key->id];
+	key->modifier = find_modifier(key->key_name);
+	set->len++;
+}
+
+/*
+  A directive line is:
+  %break_prefix <byte>
+  The break code of a key is then its make code with this byte inserted before the last byte, the decoder
+  tracks the break prefix on its own. The table only holds the make codes, and the break codes which do not
+  follow this rule, written without their break prefixes.
+ */
+static void	parse_directive(struct scan_code_set *set, char *line, uint64_t line_number)
+{
+	unsigned int	byte;
+
+	if (sscanf(line, "%%break_prefix %x", &byte) == 1 && byte != 0 && byte <= 0xFF) {
+		set->break_prefix = byte;
+		return;
+	}
+	ERR("%s:%lu: Invalid directive", set->path, line_number);
+	exit(EXIT_FAILURE);
+}
+
+static void	parse_scan_code_set(struct scan_code_set *set, char *path)
+{
+	char	    *in_buffer = read_file(path);
+	char	    *line;
+	char	    *save;
+	uint64_t    line_number = 0;
+	char	    *name;
+
+	set->path = path;
+	name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+	set->name = strndup(name, strcspn(name, "."));
+
+	line = strtok_r(in_buffer, "\n", &save);
+	while (line) {
+		line_number++;
+		if (line[0] == '%')
+			parse_directive(set, line, line_number);
+		else if (line[0] != '#')
+			parse_line(set, line, line_number);
+		line = strtok_r(NULL, "\n", &save);
+	}
+	free(in_buffer);
+}
+
+static int64_t	*index_slot(struct scan_code_set *set, uint64_t code)
+{
+	switch (code >> 8U) {
+	case 0x0:
+		return &set->single[code];
+	case 0xE0:
+		return &set->extended[0][code & 0xFF];
+	case 0xE1:
+		return &set->extended[1][code & 0xFF];
+	default:
+		return NULL;
+	}
+}
+
+/*
+  Builds the direct-index tables and the prefix automaton of `set`,
+  failing on duplicate codes and on codes that are a prefix of another.
+ */
+static bool	build_scan_code_set(struct scan_code_set *set)
+{
+	uint64_t    i;
+	uint16_t    *transition;
+	uint16_t    current;
+	int64_t	    *slot;
+	uint8_t	    len;
+	uint8_t	    n;
 
-		case 2: //status
-			if (strcmp("pressed", current_token) && strcmp("released", current_token))
-			{
-//				printf("%s ", current_token);
-				char *tmp = current_name;
-				current_name = concat(current_name, " ", current_token);
-				free(tmp);
-				continue;
+	memset(set->single, NO_KEY, sizeof(set->single));
+	memset(set->extended, NO_KEY, sizeof(set->extended));
+	set->states_len = 1;
+	i = 0;
+	while (i < set->len) {
+		if (NULL != (slot = index_slot(set, set->keys[i].code))) {
+			if (*slot != NO_KEY) {
+				ERR("%s: Duplicate code %#lx", set->path, set->keys[i].code);
+				return false;
 			}
-			sscanf(current_token, "%ms", &current_status);
-//			printf("%s \n", current_status);
+			*slot = (int64_t)i;
+		} else {
+			if (set->long_codes_len == SCAN_CODE_INDEX_MAX_LONG_CODES) {
+				ERR("%s: Too many long codes", set->path);
+				return false;
+			}
+			set->long_codes[set->long_codes_len++] = (int64_t)i;
+		}
 
-			printf("{ %#02lx, \"%s\", %s },\n", code, current_name, str_toupper(current_status));
-			state = 0;
-			free(current_name);
-			free(current_status);
-			break;
-		default:
-			assert(0);
+		len = code_len(set->keys[i].code);
+		current = 0;
+		n = 0;
+		while (n < len) {
+			transition = &set->transitions[current][code_byte(set->keys[i].code, n)];
+			if (*transition & SCAN_CODE_TRANSITION_ACCEPT) {
+				ERR("%s: Code %#lx conflicts with code %#lx", set->path, set->keys[i].code,
+					set->keys[*transition & ~SCAN_CODE_TRANSITION_ACCEPT].code);
+				return false;
+			}
+			if (n + 1U == len) {
+				if (*transition != SCAN_CODE_TRANSITION_INVALID) {
+					ERR("%s: Code %#lx is a prefix of another code", set->path, set->keys[i].code);
+					return false;
+				}
+				*transition = (uint16_t)(SCAN_CODE_TRANSITION_ACCEPT | i);
+			} else {
+				if (*transition == SCAN_CODE_TRANSITION_INVALID) {
+					if (set->states_len == SCAN_CODE_AUTOMATON_MAX_STATES) {
+						ERR("%s: Too many automaton states", set->path);
+						return false;
+					}
+					*transition = set->states_len++;
+				}
+				current = *transition;
+			}
+			n++;
+		}
+		i++;
+	}
+	// The decoder only takes the break prefix where the automaton has no transition for it
+	if (set->break_prefix != 0 && set->transitions[0][set->break_prefix] != SCAN_CODE_TRANSITION_INVALID) {
+		ERR("%s: A code starts with the break prefix %#x", set->path, set->break_prefix);
+		return false;
+	}
+	return true;
+}
+
+static void	print_c_string(const char *str)
+{
+	putchar('"');
+	while (*str) {
+		if (*str == '"' || *str == '\\')
+			putchar('\\');
+		putchar(*str);
+		str++;
+	}
+	putchar('"');
+}
+
+static void	print_names_pool(void)
+{
+	uint64_t    id = 0;
+
+	printf("static const char\tscan_code_names[] =\n");
+	while (id < key_ids_len) {
+		printf("\t");
+		print_c_string(names_pool + names_offsets[id]);
+		printf(" \"\\0\" // %lu, key id %lu\n", names_offsets[id], id);
+		id++;
+	}
+	printf("\t;\n\n");
+}
+
+static void	print_key_names(void)
+{
+	uint64_t    id = 0;
+
+	printf("const char *const\tscan_code_key_names[SCAN_CODE_MAX_KEY_IDS] = {\n");
+	while (id < key_ids_len) {
+		printf("\tscan_code_names + %lu, // %lu: ", names_offsets[id], id);
+		print_c_string(names_pool + names_offsets[id]);
+		putchar('\n');
+		id++;
+	}
+	printf("};\n\n");
+}
+
+static void	print_keys(struct scan_code_set *set)
+{
+	struct scan_key_code	*key;
+	uint64_t		i = 0;
+
+	printf("static const struct scan_key_code\t%s_keys[] = {\n", set->name);
+	while (i < set->len) {
+		key = &set->keys[i];
+		printf("\t{ %#lx, scan_code_names + %lu, %s, %s, %s, %lu }, // %lu: ",
+			key->code,
+			key->name_offset,
+			key->state == PRESSED ? "PRESSED" : "RELEASED",
+			key->ascii_value ? key->ascii_value : "0x0",
+			key->modifier,
+			key->id,
+			i);
+		// Quoted, as a trailing backslash would continue the comment on the next line
+		print_c_string(key->key_name);
+		putchar('\n');
+		i++;
+	}
+	printf("};\n\n");
+}
+
+static void	print_index_table(struct scan_code_set *set, int64_t *table, uint64_t prefix)
+{
+	uint64_t    i = 0;
+
+	while (i < 256) {
+		if (table[i] != NO_KEY)
+			printf("\t\t[%#02lx] = &%s_keys[%ld], // %#lx\n", i, set->name, table[i], (prefix << 8) | i);
+		i++;
+	}
+}
+
+static void	print_index(struct scan_code_set *set)
+{
+	uint8_t	    i;
+
+	printf("static const struct scan_code_index\t%s_index = {\n", set->name);
+	printf("\t.single = {\n");
+	print_index_table(set, set->single, 0x0);
+	printf("\t},\n\t.extended = {\n\t\t{\n");
+	print_index_table(set, set->extended[0], 0xE0);
+	printf("\t\t},\n\t\t{\n");
+	print_index_table(set, set->extended[1], 0xE1);
+	printf("\t\t},\n\t},\n\t.long_codes = {\n");
+	i = 0;
+	while (i < set->long_codes_len) {
+		printf("\t\t&%s_keys[%ld], // %#lx\n", set->name, set->long_codes[i], set->keys[set->long_codes[i]].code);
+		i++;
+	}
+	printf("\t},\n\t.long_codes_len = %u,\n};\n\n", set->long_codes_len);
+}
+
+static void	print_automaton(struct scan_code_set *set)
+{
+	uint16_t    transition;
+	uint8_t	    state = 0;
+	uint64_t    i;
+
+	printf("static const struct scan_code_automaton\t%s_automaton = {\n", set->name);
+	printf("\t.transitions = {\n");
+	while (state < set->states_len) {
+		printf("\t\t[%u] = {\n", state);
+		i = 0;
+		while (i < 256) {
+			transition = set->transitions[state][i];
+			if (transition & SCAN_CODE_TRANSITION_ACCEPT) {
+				printf("\t\t\t[%#02lx] = SCAN_CODE_TRANSITION_ACCEPT | %u,\n", i, transition & ~SCAN_CODE_TRANSITION_ACCEPT);
+			} else if (transition != SCAN_CODE_TRANSITION_INVALID) {
+				printf("\t\t\t[%#02lx] = %u,\n", i, transition);
+			}
+			i++;
 		}
+		printf("\t\t},\n");
+		state++;
+	}
+	printf("\t},\n\t.states_len = %u,\n};\n\n", set->states_len);
+}
+
+static void	print_scan_code_set(struct scan_code_set *set)
+{
+	print_keys(set);
+	print_index(set);
+	print_automaton(set);
+	printf("const struct scan_code_set\t%s = {\n", set->name);
+	printf("\t.keys = %s_keys,\n", set->name);
+	printf("\t.len = sizeof(%s_keys) / sizeof(*%s_keys),\n", set->name, set->name);
+	printf("\t.index = &%s_index,\n", set->name);
+	printf("\t.automaton = &%s_automaton,\n", set->name);
+	printf("\t.break_prefix = %#x,\n", set->break_prefix);
+	printf("};\n\n");
+}
+
+int main(int argc, char **argv)
+{
+	static struct scan_code_set	sets[8];
+	int				i;
+
+	if (argc < 2 || argc - 1 > (int)(sizeof(sets) / sizeof(*sets))) {
+		ERR("Usage: %s <scan code set table>...\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+	i = 1;
+	while (i < argc) {
+		parse_scan_code_set(&sets[i - 1], argv[i]);
+		if (!build_scan_code_set(&sets[i - 1]))
+			return EXIT_FAILURE;
+		i++;
 	}
 
+	printf("// SPDX-License-Identifier: GPL-2.0\n");
+	printf("/*\n  Generated by gen_scan_code_set_table from:\n");
+	i = 1;
+	while (i < argc)
+		printf("  %s\n", argv[i++]);
+	printf("  Do not edit, run `make tables` instead.\n */\n");
+	printf("#ifndef __SCAN_CODE_TABLES_H__\n# define __SCAN_CODE_TABLES_H__\n\n");
+	printf("# include \"scan_code_sets.h\"\n\n");
+	print_names_pool();
+	print_key_names();
+	i = 0;
+	while (i < argc - 1)
+		print_scan_code_set(&sets[i++]);
+	printf("#endif /* __SCAN_CODE_TABLES_H__ */\n");
 	return EXIT_SUCCESS;
 }
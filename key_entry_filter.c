@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: GPL-2.0
+#include "key_entry_filter.h"
+
+#define LOG __FILE__": "
+
+/*
+  Returns -EINVAL if `source` has unknown states, modifiers out of its mask, which no record could match,
+  or an empty time window. `filter` is left as it was then.
+ */
+int		key_entry_filter_compile(struct key_entry_filter *filter, const struct keyboard_driver_filter *source)
+{
+	uint64_t	to = source->to != 0 ? source->to : U64_MAX;
+	unsigned int	i;
+
+	if (source->states & ~(KEYBOARD_DRIVER_FILTER_PRESSED | KEYBOARD_DRIVER_FILTER_RELEASED)
+		|| (source->modifiers_value & ~source->modifiers_mask)
+		|| source->from > to)
+		return -EINVAL;
+	for (i = 0; i < KEY_ENTRY_FILTER_WORDS; i++) {
+		filter->accept[PRESSED][i] = source->states & KEYBOARD_DRIVER_FILTER_PRESSED ? source->key_ids[i] : 0;
+		filter->accept[RELEASED][i] = source->states & KEYBOARD_DRIVER_FILTER_RELEASED ? source->key_ids[i] : 0;
+	}
+	filter->modifiers_mask = source->modifiers_mask;
+	filter->modifiers_value = source->modifiers_value;
+	filter->from = source->from;
+	filter->to = to;
+	filter->enabled = true;
+	return 0;
+}
+
+void		key_entry_filter_disable(struct key_entry_filter *filter)
+{
+	filter->enabled = false;
+}
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: GPL-2.0
+#ifndef __KEY_ENTRY_FILTER_H__
+# define __KEY_ENTRY_FILTER_H__
+
+# include "scan_code_sets.h"
+# include "keyboard_driver.h"
+
+# define KEY_ENTRY_FILTER_WORDS (SCAN_CODE_MAX_KEY_IDS / 64U)
+
+/*
+  A `struct keyboard_driver_filter` compiled for its evaluation on each record:
+  the states and the key ids are folded into one key id bitmap per state,
+  so that a record is checked with a bit test, a mask and a range.
+ */
+struct key_entry_filter {
+	// Whether there is a filter, else every record passes
+	bool		enabled;
+
+	// Bit `id % 64` of `accept[state][id / 64]` is set if the records of key `id` in `state` pass
+	uint64_t	accept[2][KEY_ENTRY_FILTER_WORDS];
+	uint16_t	modifiers_mask;
+	uint16_t	modifiers_value;
+	uint64_t	from;
+	uint64_t	to;
+};
+
+int		key_entry_filter_compile(struct key_entry_filter *filter, const struct keyboard_driver_filter *source);
+void		key_entry_filter_disable(struct key_entry_filter *filter);
+
+/*
+  Whether `record` passes `filter`
+ */
+static inline bool	key_entry_filter_match(const struct key_entry_filter *filter,
+					       const struct keyboard_driver_record *record)
+{
+	const uint64_t	*accept = filter->accept[record->state];
+
+	if (!filter->enabled)
+		return true;
+	return ((accept[record->key_id / 64U] >> (record->key_id % 64U)) & 1U)
+		&& (record->modifiers & filter->modifiers_mask) == filter->modifiers_value
+		&& record->timestamp - filter->from <= filter->to - filter->from;
+}
+
+#endif /* __KEY_ENTRY_FILTER_H__ */
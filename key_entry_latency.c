@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: GPL-2.0
+#include "key_entry_latency.h"
+#include <linux/debugfs.h>
+#include <linux/seq_file.h>
+#include <linux/timekeeping.h>
+#include <linux/vmalloc.h>
+
+#define LOG __FILE__": "
+
+static const char *const	stage_names[KEY_ENTRY_LATENCY_STAGES] = {
+	[KEY_ENTRY_LATENCY_IRQ_TO_ENQUEUE] = "irq_to_enqueue",
+	[KEY_ENTRY_LATENCY_ENQUEUE_TO_WAKEUP] = "enqueue_to_wakeup",
+	[KEY_ENTRY_LATENCY_WAKEUP_TO_COPY] = "wakeup_to_copy",
+	[KEY_ENTRY_LATENCY_IRQ_TO_COPY] = "irq_to_copy",
+};
+
+/*
+  One line per stage: its name, the number of samples, then the count of every bucket up to the last non empty one
+ */
+static int	key_entry_latency_show(struct seq_file *seq_file, void *v)
+{
+	struct key_entry_latency		*latency = seq_file->private;
+	struct key_entry_latency_histogram	*histogram;
+	u64					buckets[KEY_ENTRY_LATENCY_BUCKETS];
+	u64					samples;
+	unsigned int				stage;
+	unsigned int				last;
+	unsigned int				i;
+	int					cpu;
+
+	seq_puts(seq_file, "# stage samples count[2^i ns, 2^(i+1) ns)...\n");
+	for (stage = 0; stage < KEY_ENTRY_LATENCY_STAGES; stage++) {
+		memset(buckets, 0, sizeof(buckets));
+		for_each_possible_cpu(cpu) {
+			histogram = per_cpu_ptr(latency->histograms, cpu);
+			for (i = 0; i < KEY_ENTRY_LATENCY_BUCKETS; i++)
+				buckets[i] += READ_ONCE(histogram->buckets[stage][i]);
+		}
+		samples = 0;
+		last = 0;
+		for (i = 0; i < KEY_ENTRY_LATENCY_BUCKETS; i++) {
+			samples += buckets[i];
+			if (buckets[i] != 0)
+				last = i;
+		}
+		seq_printf(seq_file, "%s %llu", stage_names[stage], samples);
+		for (i = 0; samples != 0 && i <= last; i++)
+			seq_printf(seq_file, " %llu", buckets[i]);
+		seq_putc(seq_file, '\n');
+	}
+	return 0;
+}
+
+static int	key_entry_latency_open(struct inode *inode, struct file *file)
+{
+	return single_open(file, &key_entry_latency_show, inode->i_private);
+}
+
+/*
+  Any write resets the histograms
+ */
+static ssize_t	key_entry_latency_write(struct file *file, const char __user *buf, size_t count, loff_t *pos)
+{
+	struct seq_file	*seq_file = file->private_data;
+
+	key_entry_latency_reset(seq_file->private);
+	return count;
+}
+
+static const struct file_operations	key_entry_latency_fops = {
+	.owner = THIS_MODULE,
+	.open = &key_entry_latency_open,
+	.read = &seq_read,
+	.write = &key_entry_latency_write,
+	.llseek = &seq_lseek,
+	.release = &single_release,
+};
+
+/*
+  The histograms are shown in `debugfs_dir`/latency, the latencies are still recorded without debugfs
+ */
+int		key_entry_latency_init(struct key_entry_latency *latency, struct key_entry_ring *ring,
+				       struct dentry *debugfs_dir)
+{
+	latency->capacity = ring->capacity;
+	latency->file = NULL;
+	latency->histograms = alloc_percpu(struct key_entry_latency_histogram);
+	latency->stamps = vzalloc(array_size(latency->capacity, sizeof(*latency->stamps)));
+	if (latency->histograms == NULL || latency->stamps == NULL) {
+		key_entry_latency_destroy(latency);
+		return -ENOMEM;
+	}
+	if (!IS_ERR_OR_NULL(debugfs_dir))
+		latency->file = debugfs_create_file("latency", 0600, debugfs_dir, latency, &key_entry_latency_fops);
+	return 0;
+}
+
+void		key_entry_latency_destroy(struct key_entry_latency *latency)
+{
+	debugfs_remove(latency->file);
+	free_percpu(latency->histograms);
+	vfree(latency->stamps);
+	latency->file = NULL;
+	latency->histograms = NULL;
+	latency->stamps = NULL;
+}
+
+/*
+  Producer side, the entry of sequence `seq` was pushed to the ring, from a byte read at `irq`.
+  `irq` is taken with ktime_get_mono_fast_ns(), possibly on another CPU, and may be slightly ahead of now.
+ */
+void		key_entry_latency_enqueued(struct key_entry_latency *latency, uint64_t seq, u64 irq)
+{
+	struct key_entry_latency_stamp	*stamp;
+	u64				now;
+
+	if (latency->stamps == NULL)
+		return;
+	now = ktime_get_ns();
+	stamp = &latency->stamps[seq & (latency->capacity - 1)];
+	WRITE_ONCE(stamp->irq, irq);
+	WRITE_ONCE(stamp->enqueue, now);
+	key_entry_latency_record(latency, KEY_ENTRY_LATENCY_IRQ_TO_ENQUEUE, now > irq ? now - irq : 0);
+}
+
+/*
+  Consumer side, a reader was woken up for the entry of sequence `seq`, returns the time it was.
+  The stamps are not synchronized with the ring, an entry which was evicted meanwhile
+  is timed from the enqueue of the one which took its place, hence the latencies are only clamped to 0.
+ */
+u64		key_entry_latency_woken(struct key_entry_latency *latency, uint64_t seq)
+{
+	u64	now = ktime_get_ns();
+	u64	enqueue;
+
+	if (latency->stamps == NULL)
+		return now;
+	enqueue = READ_ONCE(latency->stamps[seq & (latency->capacity - 1)].enqueue);
+	if (enqueue != 0)
+		key_entry_latency_record(latency, KEY_ENTRY_LATENCY_ENQUEUE_TO_WAKEUP, now > enqueue ? now - enqueue : 0);
+	return now;
+}
+
+/*
+  Time of the interrupt of the entry of sequence `seq`, 0 if unknown
+ */
+u64		key_entry_latency_irq(struct key_entry_latency *latency, uint64_t seq)
+{
+	if (latency->stamps == NULL)
+		return 0;
+	return READ_ONCE(latency->stamps[seq & (latency->capacity - 1)].irq);
+}
+
+/*
+  Racy against the CPUs recording a latency meanwhile, which may keep their sample
+ */
+void		key_entry_latency_reset(struct key_entry_latency *latency)
+{
+	int	cpu;
+
+	for_each_possible_cpu(cpu)
+		memset(per_cpu_ptr(latency->histograms, cpu), 0, sizeof(struct key_entry_latency_histogram));
+}
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: GPL-2.0
+#ifndef __KEY_ENTRY_LATENCY_H__
+# define __KEY_ENTRY_LATENCY_H__
+
+# include <linux/percpu.h>
+# include <linux/log2.h>
+# include "key_entry_ring.h"
+
+struct dentry;
+
+/*
+  Stages of the way of a key entry from the keyboard to a reader, each timed in ns on the monotonic clock
+ */
+enum key_entry_latency_stage {
+	// From the interrupt handler reading the byte, to the interrupt thread pushing the entry to the ring
+	KEY_ENTRY_LATENCY_IRQ_TO_ENQUEUE,
+	// From the entry being pushed, to a reader waiting for it being woken up
+	KEY_ENTRY_LATENCY_ENQUEUE_TO_WAKEUP,
+	// From the reader being woken up, to read() returning, which covers the text formatting of the text mode
+	KEY_ENTRY_LATENCY_WAKEUP_TO_COPY,
+	// From the interrupt handler reading the first byte of the first entry read(), to read() returning.
+	// As the previous stage, only timed for the reads which waited for their entries
+	KEY_ENTRY_LATENCY_IRQ_TO_COPY,
+	KEY_ENTRY_LATENCY_STAGES
+};
+
+// Bucket i counts the latencies of [2^i, 2^(i + 1)) ns, bucket 0 also counts 0
+# define KEY_ENTRY_LATENCY_BUCKETS 64U
+
+struct key_entry_latency_histogram {
+	u64	buckets[KEY_ENTRY_LATENCY_STAGES][KEY_ENTRY_LATENCY_BUCKETS];
+};
+
+/*
+  Time of the interrupt and of the enqueue of an entry
+ */
+struct key_entry_latency_stamp {
+	u64	irq;
+	u64	enqueue;
+};
+
+/*
+  log2 histograms of the latency of each stage, in per-CPU buckets so that recording
+  a latency is a single increment without any shared cache line.
+  The stamps of the entries live beside the ring, at the same index as their record,
+  so that the readers can tell when the entries they read were produced.
+ */
+struct key_entry_latency {
+	struct key_entry_latency_histogram __percpu	*histograms;
+
+	struct key_entry_latency_stamp			*stamps;
+	uint64_t					capacity;
+
+	struct dentry					*file;
+};
+
+int		key_entry_latency_init(struct key_entry_latency *latency, struct key_entry_ring *ring,
+				       struct dentry *debugfs_dir);
+void		key_entry_latency_destroy(struct key_entry_latency *latency);
+void		key_entry_latency_enqueued(struct key_entry_latency *latency, uint64_t seq, u64 irq);
+u64		key_entry_latency_woken(struct key_entry_latency *latency, uint64_t seq);
+u64		key_entry_latency_irq(struct key_entry_latency *latency, uint64_t seq);
+void		key_entry_latency_reset(struct key_entry_latency *latency);
+
+static inline void	key_entry_latency_record(struct key_entry_latency *latency,
+						 enum key_entry_latency_stage stage, u64 ns)
+{
+	if (latency->histograms == NULL)
+		return;
+	this_cpu_inc(latency->histograms->buckets[stage][ns ? ilog2(ns) : 0]);
+}
+
+#endif /* __KEY_ENTRY_LATENCY_H__ */
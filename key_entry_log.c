@@ -0,0 +1,297 @@
+// SPDX-License-Identifier: GPL-2.0
+#include "key_entry_log.h"
+#include <linux/fs.h>
+#include <linux/slab.h>
+#include <linux/vmalloc.h>
+#include <linux/jiffies.h>
+#include <linux/lz4.h>
+
+#define LOG __FILE__": "
+
+/*
+  Copies up to `batch` records from the cursor to the staging buffer, returns their number.
+  The cursor is only moved past the records which were evicted meanwhile.
+ */
+static uint64_t	key_entry_log_stage(struct key_entry_log *log)
+{
+	uint64_t    staged;
+	uint64_t    n;
+
+	do {
+		key_entry_ring_catch_up(log->ring, &log->cursor);
+		staged = 0;
+		while (staged < log->batch
+			&& 0 != (n = key_entry_ring_contiguous(log->ring, log->cursor.seq + staged))) {
+			n = min_t(uint64_t, n, log->batch - staged);
+			memcpy(log->records + staged, key_entry_ring_peek(log->ring, log->cursor.seq + staged),
+				n * sizeof(*log->records));
+			staged += n;
+		}
+	} while (key_entry_ring_catch_up(log->ring, &log->cursor) != 0);
+	return staged;
+}
+
+static u8	*put_varint(u8 *dst, uint64_t value)
+{
+	while (value >= 0x80) {
+		*dst++ = (value & 0x7f) | 0x80;
+		value >>= 7;
+	}
+	*dst++ = value;
+	return dst;
+}
+
+/*
+  Encodes the `n` staged records as described in keyboard_driver_log.h, returns the size of the encoding
+ */
+static size_t	key_entry_log_encode(struct key_entry_log *log, uint64_t n)
+{
+	const struct keyboard_driver_record	*record;
+	uint64_t				timestamp = log->records[0].timestamp;
+	uint16_t				modifiers = 0;
+	int64_t					delta;
+	u8					*dst = log->raw;
+	u8					flags;
+	uint64_t				i;
+
+	for (i = 0; i < n; i++) {
+		record = &log->records[i];
+		delta = record->timestamp - timestamp;
+		timestamp = record->timestamp;
+		// Zigzag, the format allows timestamps going backwards
+		dst = put_varint(dst, ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63));
+		dst = put_varint(dst, record->code);
+		*dst++ = record->key_id;
+		flags = record->state == RELEASED ? KEYBOARD_DRIVER_LOG_RELEASED : 0;
+		if (record->modifiers != modifiers)
+			flags |= KEYBOARD_DRIVER_LOG_MODIFIERS;
+		if (record->ascii_value != 0)
+			flags |= KEYBOARD_DRIVER_LOG_ASCII;
+		if (record->flags & KEYBOARD_DRIVER_RECORD_REPEAT)
+			flags |= KEYBOARD_DRIVER_LOG_REPEAT;
+		*dst++ = flags;
+		if (flags & KEYBOARD_DRIVER_LOG_MODIFIERS) {
+			dst = put_varint(dst, record->modifiers);
+			modifiers = record->modifiers;
+		}
+		if (flags & KEYBOARD_DRIVER_LOG_ASCII)
+			*dst++ = record->ascii_value;
+		if (flags & KEYBOARD_DRIVER_LOG_REPEAT)
+			dst = put_varint(dst, record->repeats);
+	}
+	return dst - log->raw;
+}
+
+/*
+  Builds the block of the `n` staged records, returns its size, header included
+ */
+static size_t	key_entry_log_build_block(struct key_entry_log *log, uint64_t n)
+{
+	struct keyboard_driver_log_block	*header = (void *)log->block;
+	size_t					raw_size;
+	int					size;
+
+	raw_size = key_entry_log_encode(log, n);
+	size = LZ4_compress_default((const char *)log->raw, (char *)log->block + sizeof(*header), raw_size,
+				    log->block_size - sizeof(*header), log->lz4_workmem);
+	memset(header, 0, sizeof(*header));
+	header->magic = KEYBOARD_DRIVER_LOG_MAGIC;
+	header->version = KEYBOARD_DRIVER_LOG_VERSION;
+	header->records = n;
+	header->raw_size = raw_size;
+	header->first_seq = log->cursor.seq;
+	header->first_timestamp = log->records[0].timestamp + log->realtime_offset;
+	header->last_timestamp = log->records[n - 1].timestamp + log->realtime_offset;
+	if (size > 0 && (size_t)size < raw_size) {
+		header->flags = KEYBOARD_DRIVER_LOG_LZ4;
+		header->size = size;
+	} else {
+		// Incompressible
+		memcpy(log->block + sizeof(*header), log->raw, raw_size);
+		header->size = raw_size;
+	}
+	return sizeof(*header) + header->size;
+}
+
+/*
+  The index is only a shortcut, it can be rebuilt from the log, hence its failures are only counted
+ */
+static void	key_entry_log_index(struct key_entry_log *log, loff_t offset)
+{
+	struct keyboard_driver_log_block	*header = (void *)log->block;
+	struct keyboard_driver_log_index	entry;
+	ssize_t					ret;
+
+	entry.first_timestamp = header->first_timestamp;
+	entry.last_timestamp = header->last_timestamp;
+	entry.offset = offset;
+	ret = kernel_write(log->index_file, &entry, sizeof(entry), &log->index_pos);
+	if (ret != sizeof(entry)) {
+		log->errors++;
+		log->index_pos -= max_t(ssize_t, ret, 0);
+	}
+}
+
+/*
+  Writes every pending record, stops at the first failed write, whose block is written again on the next flush
+ */
+static void	key_entry_log_flush(struct key_entry_log *log)
+{
+	uint64_t    staged;
+	size_t	    size;
+	loff_t	    offset;
+	ssize_t	    ret;
+	bool	    wrote = false;
+
+	while (0 != (staged = key_entry_log_stage(log))) {
+		size = key_entry_log_build_block(log, staged);
+		offset = log->pos;
+		ret = kernel_write(log->file, log->block, size, &log->pos);
+		if (ret != (ssize_t)size) {
+			log->errors++;
+			printk_ratelimited(KERN_WARNING LOG "Failed to write the log: %zd\n", ret);
+			// Over the torn block
+			log->pos = offset;
+			break;
+		}
+		wrote = true;
+		if (log->index_file != NULL)
+			key_entry_log_index(log, offset);
+		log->written += staged;
+		log->written_bytes += size;
+		WRITE_ONCE(log->cursor.seq, log->cursor.seq + staged);
+	}
+	if (wrote && log->fsync == KEY_ENTRY_LOG_FSYNC_FLUSH)
+		vfs_fsync(log->file, 1);
+}
+
+static void	key_entry_log_work(struct work_struct *work)
+{
+	struct key_entry_log	*log = container_of(to_delayed_work(work), struct key_entry_log, work);
+
+	key_entry_log_flush(log);
+}
+
+static void	key_entry_log_free(struct key_entry_log *log)
+{
+	kfree(log->records);
+	kfree(log->raw);
+	vfree(log->block);
+	vfree(log->lz4_workmem);
+	log->records = NULL;
+}
+
+static struct file	*key_entry_log_open(const char *path)
+{
+	struct file	*file;
+
+	// Not O_APPEND, so that a torn block can be written over
+	file = filp_open(path, O_WRONLY | O_CREAT | O_LARGEFILE, 0600);
+	if (IS_ERR(file))
+		printk(KERN_WARNING LOG "Failed to open %s: %ld\n", path, PTR_ERR(file));
+	return file;
+}
+
+/*
+  The log starts at the oldest record of the ring, appended at the end of the file at `path`.
+  The index is appended to `path`.idx, the log goes on without it if it cannot be opened.
+  The monotonic timestamps of the records are logged plus `realtime_offset`, in ns since the epoch.
+ */
+int		key_entry_log_init(struct key_entry_log *log, struct key_entry_ring *ring, const char *path,
+				   unsigned int batch, unsigned int interval_ms, enum key_entry_log_fsync fsync,
+				   u64 realtime_offset)
+{
+	char	*index_path;
+	size_t	raw_size;
+
+	if (batch == 0)
+		return -EINVAL;
+	log->ring = ring;
+	log->cursor.seq = key_entry_ring_oldest(ring);
+	log->cursor.lost = 0;
+	log->batch = batch;
+	log->interval = msecs_to_jiffies(interval_ms);
+	log->fsync = fsync;
+	log->realtime_offset = realtime_offset;
+	log->written = 0;
+	log->written_bytes = 0;
+	log->errors = 0;
+	log->index_file = NULL;
+	INIT_DELAYED_WORK(&log->work, &key_entry_log_work);
+
+	raw_size = (size_t)batch * KEYBOARD_DRIVER_LOG_MAX_ENTRY_SIZE;
+	log->block_size = sizeof(struct keyboard_driver_log_block) + max_t(size_t, raw_size, LZ4_compressBound(raw_size));
+	log->records = kmalloc_array(batch, sizeof(*log->records), GFP_KERNEL);
+	log->raw = kmalloc(raw_size, GFP_KERNEL);
+	log->block = vmalloc(log->block_size);
+	log->lz4_workmem = vmalloc(LZ4_MEM_COMPRESS);
+	if (!log->records || !log->raw || !log->block || !log->lz4_workmem) {
+		key_entry_log_free(log);
+		return -ENOMEM;
+	}
+
+	log->file = key_entry_log_open(path);
+	if (IS_ERR(log->file)) {
+		key_entry_log_free(log);
+		return PTR_ERR(log->file);
+	}
+	log->pos = i_size_read(file_inode(log->file));
+
+	index_path = kasprintf(GFP_KERNEL, "%s.idx", path);
+	if (index_path != NULL) {
+		log->index_file = key_entry_log_open(index_path);
+		if (IS_ERR(log->index_file))
+			log->index_file = NULL;
+		else
+			log->index_pos = i_size_read(file_inode(log->index_file));
+		kfree(index_path);
+	}
+	return 0;
+}
+
+/*
+  Writes the records left, as the producer is stopped
+ */
+void		key_entry_log_destroy(struct key_entry_log *log)
+{
+	if (!key_entry_log_enabled(log))
+		return;
+	cancel_delayed_work_sync(&log->work);
+	key_entry_log_flush(log);
+	if (log->fsync != KEY_ENTRY_LOG_FSYNC_NEVER)
+		vfs_fsync(log->file, 0);
+	filp_close(log->file, NULL);
+	if (log->index_file != NULL)
+		filp_close(log->index_file, NULL);
+	key_entry_log_free(log);
+	printk(KERN_INFO LOG "%llu key entries were logged in %llu bytes\n", log->written, log->written_bytes);
+	if (log->cursor.lost != 0 || log->errors != 0)
+		printk(KERN_INFO LOG "%llu key entries were evicted before they could be logged, %llu writes failed\n",
+			log->cursor.lost, log->errors);
+}
+
+bool		key_entry_log_enabled(struct key_entry_log *log)
+{
+	return log->records != NULL;
+}
+
+/*
+  Producer side, schedules a flush once `batch` records are pending, else in `interval` at the latest
+ */
+void		key_entry_log_kick(struct key_entry_log *log)
+{
+	if (!key_entry_log_enabled(log))
+		return;
+	if (key_entry_ring_available(log->ring, key_entry_log_cursor(log)) >= log->batch)
+		mod_delayed_work(system_unbound_wq, &log->work, 0);
+	else
+		queue_delayed_work(system_unbound_wq, &log->work, log->interval);
+}
+
+/*
+  Sequence number of the next record to be logged, the records before it can be reclaimed
+ */
+uint64_t	key_entry_log_cursor(struct key_entry_log *log)
+{
+	return READ_ONCE(log->cursor.seq);
+}
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: GPL-2.0
+#ifndef __KEY_ENTRY_LOG_H__
+# define __KEY_ENTRY_LOG_H__
+
+# include <linux/workqueue.h>
+# include "key_entry_ring.h"
+# include "keyboard_driver_log.h"
+
+/*
+  When the log file is synced to its storage
+ */
+enum key_entry_log_fsync {
+	// Left to the writeback of the page cache
+	KEY_ENTRY_LOG_FSYNC_NEVER,
+	// Once, as the log is closed
+	KEY_ENTRY_LOG_FSYNC_CLOSE,
+	// After every flush
+	KEY_ENTRY_LOG_FSYNC_FLUSH,
+};
+
+/*
+  Appends the records of a key entry ring to a file, from a worker so that
+  the filesystem is never touched from the interrupt thread.
+  The log reads the ring through its own cursor, like the readers of the device, and writes
+  the records by blocks of at most `batch` of them, in the format of keyboard_driver_log.h:
+  as soon as `batch` records are pending, else `interval` after the producer kicked it.
+ */
+struct key_entry_log {
+	struct key_entry_ring		*ring;
+	struct key_entry_cursor		cursor;
+
+	struct file			*file;
+	loff_t				pos;
+
+	// Time index of the blocks of `file`
+	struct file			*index_file;
+	loff_t				index_pos;
+
+	// Staging buffer of `batch` records, the ring may evict them while they are written
+	struct keyboard_driver_record	*records;
+	unsigned int			batch;
+
+	// Encoded records, and the block they are compressed to, header included
+	u8				*raw;
+	u8				*block;
+	size_t				block_size;
+	void				*lz4_workmem;
+
+	// Added to the monotonic timestamps of the records, as the log is dated by the wall clock
+	u64				realtime_offset;
+
+	// In jiffies
+	unsigned long			interval;
+	enum key_entry_log_fsync	fsync;
+	struct delayed_work		work;
+
+	// Number of records and bytes written, and of failed writes
+	uint64_t			written;
+	uint64_t			written_bytes;
+	uint64_t			errors;
+};
+
+int		key_entry_log_init(struct key_entry_log *log, struct key_entry_ring *ring, const char *path,
+				   unsigned int batch, unsigned int interval_ms, enum key_entry_log_fsync fsync,
+				   u64 realtime_offset);
+void		key_entry_log_destroy(struct key_entry_log *log);
+void		key_entry_log_kick(struct key_entry_log *log);
+bool		key_entry_log_enabled(struct key_entry_log *log);
+uint64_t	key_entry_log_cursor(struct key_entry_log *log);
+
+#endif /* __KEY_ENTRY_LOG_H__ */
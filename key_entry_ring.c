@@ -0,0 +1,200 @@
+// SPDX-License-Identifier: GPL-2.0
+#include "key_entry_ring.h"
+#include <linux/vmalloc.h>
+#include <linux/log2.h>
+#include <linux/mm.h>
+
+#define LOG __FILE__": "
+
+/*
+  `limit` is clamped to the capacity of the ring, which is rounded up to a power of 2
+ */
+int		key_entry_ring_init(struct key_entry_ring *ring, unsigned long capacity,
+				    unsigned long limit, enum key_entry_ring_policy policy)
+{
+	if (capacity == 0 || limit == 0)
+		return -EINVAL;
+	ring->capacity = roundup_pow_of_two(capacity);
+	ring->limit = min_t(uint64_t, limit, ring->capacity);
+	ring->policy = policy;
+	ring->head = 0;
+	ring->tail = 0;
+	ring->evicted = 0;
+	ring->dropped = 0;
+	ring->area_size = PAGE_SIZE + PAGE_ALIGN(ring->capacity * sizeof(*ring->records));
+	// Zeroed, and suitable for remap_vmalloc_range()
+	ring->area = vmalloc_user(ring->area_size);
+	if (ring->area == NULL) {
+		printk(KERN_WARNING LOG "Failed to allocate a ring of %llu entries\n", ring->capacity);
+		return -ENOMEM;
+	}
+	ring->header = ring->area;
+	ring->records = ring->area + PAGE_SIZE;
+	ring->header->capacity = ring->capacity;
+	ring->header->records_offset = PAGE_SIZE;
+	ring->header->record_size = sizeof(*ring->records);
+	ring->header->limit = ring->limit;
+	return 0;
+}
+
+void		key_entry_ring_destroy(struct key_entry_ring *ring)
+{
+	vfree(ring->area);
+	ring->area = NULL;
+}
+
+static void	key_entry_ring_set_tail(struct key_entry_ring *ring, uint64_t tail)
+{
+	WRITE_ONCE(ring->tail, tail);
+	WRITE_ONCE(ring->header->tail, tail);
+}
+
+/*
+  Producer side, whether the retention limit is reached
+ */
+bool		key_entry_ring_full(struct key_entry_ring *ring)
+{
+	return ring->head - ring->tail >= ring->limit;
+}
+
+/*
+  Producer side, releases the records before sequence `seq`, which every consumer is done with
+ */
+void		key_entry_ring_reclaim(struct key_entry_ring *ring, uint64_t seq)
+{
+	seq = min(seq, ring->head);
+	if ((int64_t)(seq - ring->tail) > 0)
+		key_entry_ring_set_tail(ring, seq);
+}
+
+/*
+  Producer side, evicts the oldest record or drops `record`, depending on the policy, if the ring is full.
+  Returns false if `record` was dropped.
+  Nothing is read from the shared area, which userspace can only map read only.
+ */
+bool		key_entry_ring_push(struct key_entry_ring *ring, const struct keyboard_driver_record *record)
+{
+	uint64_t    head = ring->head;
+
+	if (key_entry_ring_full(ring)) {
+		if (ring->policy == KEY_ENTRY_RING_DROP_NEWEST) {
+			ring->dropped++;
+			WRITE_ONCE(ring->header->dropped, ring->dropped);
+			return false;
+		}
+		ring->evicted++;
+		WRITE_ONCE(ring->header->evicted, ring->evicted);
+		// Announces that the oldest record is about to be overwritten, if the ring is physically full
+		key_entry_ring_set_tail(ring, head + 1 - ring->limit);
+	}
+	// Pairs with the smp_rmb() in key_entry_ring_catch_up(), which checks `tail` once the records were read
+	smp_wmb();
+	ring->records[head & (ring->capacity - 1)] = *record;
+	// Publishes the record before the new head
+	smp_store_release(&ring->head, head + 1);
+	smp_store_release(&ring->header->head, head + 1);
+	return true;
+}
+
+uint64_t	key_entry_ring_head(struct key_entry_ring *ring)
+{
+	return smp_load_acquire(&ring->head);
+}
+
+/*
+  Sequence number of the oldest retained record
+ */
+uint64_t	key_entry_ring_oldest(struct key_entry_ring *ring)
+{
+	return READ_ONCE(ring->tail);
+}
+
+/*
+  Consumer side, moves the cursor past the records which are not retained anymore and returns their number.
+  Called once the records were read, it tells whether they were evicted, hence possibly overwritten, meanwhile.
+ */
+uint64_t	key_entry_ring_catch_up(struct key_entry_ring *ring, struct key_entry_cursor *cursor)
+{
+	uint64_t    oldest;
+	uint64_t    lost;
+
+	// Pairs with the smp_wmb() in key_entry_ring_push()
+	smp_rmb();
+	oldest = key_entry_ring_oldest(ring);
+	if ((int64_t)(oldest - cursor->seq) <= 0)
+		return 0;
+	lost = oldest - cursor->seq;
+	WRITE_ONCE(cursor->seq, oldest);
+	WRITE_ONCE(cursor->lost, cursor->lost + lost);
+	return lost;
+}
+
+/*
+  Consumer side, returns the record of sequence `seq` or NULL if it was not produced yet.
+  The record may be evicted and overwritten at any time, see key_entry_ring_catch_up().
+ */
+struct keyboard_driver_record	*key_entry_ring_peek(struct key_entry_ring *ring, uint64_t seq)
+{
+	// Pairs with the release in key_entry_ring_push()
+	if ((int64_t)(smp_load_acquire(&ring->head) - seq) <= 0)
+		return NULL;
+	return &ring->records[seq & (ring->capacity - 1)];
+}
+
+/*
+  Consumer side, number of records produced from sequence `seq`.
+ */
+uint64_t	key_entry_ring_available(struct key_entry_ring *ring, uint64_t seq)
+{
+	int64_t	    available = smp_load_acquire(&ring->head) - seq;
+
+	return available > 0 ? available : 0;
+}
+
+/*
+  Consumer side, number of records produced from sequence `seq` that are contiguous in `records`.
+ */
+uint64_t	key_entry_ring_contiguous(struct key_entry_ring *ring, uint64_t seq)
+{
+	int64_t	    available = smp_load_acquire(&ring->head) - seq;
+	uint64_t    until_wrap = ring->capacity - (seq & (ring->capacity - 1));
+
+	if (available <= 0)
+		return 0;
+	return min_t(uint64_t, available, until_wrap);
+}
+
+/*
+  Consumer side, copies the record under the cursor to `record` and moves the cursor past it.
+  Returns false if no record was produced there yet.
+ */
+bool		key_entry_ring_read(struct key_entry_ring *ring, struct key_entry_cursor *cursor,
+				    struct keyboard_driver_record *record)
+{
+	struct keyboard_driver_record	*slot;
+
+	do {
+		key_entry_ring_catch_up(ring, cursor);
+		slot = key_entry_ring_peek(ring, cursor->seq);
+		if (slot == NULL)
+			return false;
+		*record = *slot;
+	} while (key_entry_ring_catch_up(ring, cursor) != 0);
+	WRITE_ONCE(cursor->seq, cursor->seq + 1);
+	return true;
+}
+
+/*
+  Maps the control page and the records, from the start of the area only.
+  The mapping is read only, and cannot be made writable by mprotect() either.
+  vm_flags_clear() is Linux 6.3 or later, see the version check of main.c.
+ */
+int		key_entry_ring_mmap(struct key_entry_ring *ring, struct vm_area_struct *vma)
+{
+	if (vma->vm_pgoff != 0)
+		return -EINVAL;
+	if (vma->vm_flags & VM_WRITE)
+		return -EPERM;
+	vm_flags_clear(vma, VM_MAYWRITE);
+	return remap_vmalloc_range(vma, ring->area, 0);
+}
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: GPL-2.0
+#ifndef __KEY_ENTRY_RING_H__
+# define __KEY_ENTRY_RING_H__
+
+# include "scan_code_sets.h"
+# include "keyboard_driver.h"
+
+struct vm_area_struct;
+
+/*
+  What to do with a new record once `limit` records are retained
+ */
+enum key_entry_ring_policy {
+	// Evict the oldest record
+	KEY_ENTRY_RING_DROP_OLDEST,
+	// Drop the new record
+	KEY_ENTRY_RING_DROP_NEWEST,
+};
+
+/*
+  Fixed capacity single producer, multiple consumers ring of key entries, in the
+  `struct keyboard_driver_record` format so that userspace can map it.
+  The area starts with a `struct keyboard_driver_ring_header` control page, followed by the records.
+  `head` and `tail` are free running sequence numbers, the record of sequence `seq` lives at
+  `records[seq & (capacity - 1)]`. The records from `tail` to `head` are retained, at most `limit` of them.
+  The producer (the interrupt thread) never waits for the consumers, it evicts or drops a record
+  once the retention limit is reached. `tail` also moves forward as the producer reclaims the records
+  every consumer is done with. Each consumer reads from its own `struct key_entry_cursor` and checks that
+  the records it read were not evicted meanwhile, so that neither side takes a lock
+  and a slow consumer only loses its own records.
+ */
+struct key_entry_ring {
+	// Sequence number of the next record to be produced, published to `header->head`
+	uint64_t				head;
+
+	// Sequence number of the oldest retained record, published to `header->tail`
+	uint64_t				tail;
+
+	// Number of records of `records`, a power of 2
+	uint64_t				capacity;
+
+	// Maximum number of retained records, at most `capacity`
+	uint64_t				limit;
+	enum key_entry_ring_policy		policy;
+
+	// Number of records evicted, and dropped, as the retention limit was reached
+	uint64_t				evicted;
+	uint64_t				dropped;
+
+	// vmalloc_user() area shared with userspace, and its size
+	void					*area;
+	unsigned long				area_size;
+
+	struct keyboard_driver_ring_header	*header;
+	struct keyboard_driver_record		*records;
+};
+
+/*
+  Position of a consumer in the ring.
+  Only its consumer moves it, but the reclamation and the stats read it locklessly: stores use WRITE_ONCE().
+ */
+struct key_entry_cursor {
+	// Sequence number of the next record to be read
+	uint64_t	seq;
+
+	// Number of records that were evicted before they could be read
+	uint64_t	lost;
+};
+
+int			key_entry_ring_init(struct key_entry_ring *ring, unsigned long capacity,
+					    unsigned long limit, enum key_entry_ring_policy policy);
+void			key_entry_ring_destroy(struct key_entry_ring *ring);
+bool			key_entry_ring_full(struct key_entry_ring *ring);
+void			key_entry_ring_reclaim(struct key_entry_ring *ring, uint64_t seq);
+bool			key_entry_ring_push(struct key_entry_ring *ring, const struct keyboard_driver_record *record);
+uint64_t		key_entry_ring_head(struct key_entry_ring *ring);
+uint64_t		key_entry_ring_oldest(struct key_entry_ring *ring);
+uint64_t		key_entry_ring_catch_up(struct key_entry_ring *ring, struct key_entry_cursor *cursor);
+struct keyboard_driver_record	*key_entry_ring_peek(struct key_entry_ring *ring, uint64_t seq);
+uint64_t		key_entry_ring_available(struct key_entry_ring *ring, uint64_t seq);
+uint64_t		key_entry_ring_contiguous(struct key_entry_ring *ring, uint64_t seq);
+bool			key_entry_ring_read(struct key_entry_ring *ring, struct key_entry_cursor *cursor,
+					    struct keyboard_driver_record *record);
+int			key_entry_ring_mmap(struct key_entry_ring *ring, struct vm_area_struct *vma);
+
+#endif /* __KEY_ENTRY_RING_H__ */
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: GPL-2.0
+#include "key_entry_text.h"
+#include <linux/time64.h>
+
+#define LOG __FILE__": "
+
+struct key_entry_text_fragment {
+	char		text[KEY_ENTRY_TEXT_MAX_NAME];
+	uint8_t		len;
+};
+
+// `name(` of each key id, "unknown(" for the ids that are not in use
+static struct key_entry_text_fragment	names[SCAN_CODE_MAX_KEY_IDS];
+
+static const struct key_entry_text_fragment	states[] = {
+	[PRESSED] = { ") Pressed\n", 10 },
+	[RELEASED] = { ") Released\n", 11 },
+};
+
+static const struct key_entry_text_fragment	repeated = { ") Repeated ", 11 };
+
+static const char	hex_digits[] = "0123456789abcdef";
+
+/*
+  Builds the name fragments, once before any key_entry_text_format()
+ */
+void		key_entry_text_setup(void)
+{
+	const char	*name;
+	size_t		len;
+	unsigned int	i;
+
+	for (i = 0; i < SCAN_CODE_MAX_KEY_IDS; i++) {
+		name = scan_code_key_names[i] ? scan_code_key_names[i] : "unknown";
+		len = strlen(name);
+		if (WARN_ON(len > KEY_ENTRY_TEXT_MAX_NAME - 1U))
+			len = KEY_ENTRY_TEXT_MAX_NAME - 1U;
+		memcpy(names[i].text, name, len);
+		names[i].text[len] = '(';
+		names[i].len = len + 1U;
+	}
+}
+
+void		key_entry_text_init(struct key_entry_text *text, uint64_t realtime_offset)
+{
+	text->realtime_offset = realtime_offset;
+	text->second = 0;
+	text->second_valid = false;
+}
+
+static void	put_two_digits(char *dst, unsigned int n)
+{
+	dst[0] = '0' + n / 10U;
+	dst[1] = '0' + n % 10U;
+}
+
+/*
+  Builds the prefix of the second of `realtime`, in ns since the epoch
+ */
+static void	key_entry_text_set_second(struct key_entry_text *text, uint64_t realtime)
+{
+	uint64_t	date = realtime / NSEC_PER_SEC;
+	unsigned int	day_seconds = date % 86400U;
+
+	text->second = date * NSEC_PER_SEC;
+	text->second_valid = true;
+	put_two_digits(text->prefix, day_seconds / 3600U);
+	text->prefix[2] = ':';
+	put_two_digits(text->prefix + 3, (day_seconds / 60U) % 60U);
+	text->prefix[5] = ':';
+	put_two_digits(text->prefix + 6, day_seconds % 60U);
+	text->prefix[8] = ' ';
+}
+
+/*
+  Same as %#02llx
+ */
+static char	*put_code(char *dst, uint64_t code)
+{
+	unsigned int	digits = scan_key_code_len(code) * 2U;
+
+	// No 0x for 0, only the padding
+	if (code == 0) {
+		*dst++ = '0';
+		*dst++ = '0';
+		return dst;
+	}
+	if ((code >> ((digits - 1U) * 4U)) == 0)
+		digits--;
+	*dst++ = '0';
+	*dst++ = 'x';
+	while (digits-- != 0)
+		*dst++ = hex_digits[(code >> (digits * 4U)) & 0xF];
+	return dst;
+}
+
+static char	*put_decimal(char *dst, unsigned int n)
+{
+	char		digits[10];
+	unsigned int	len = 0;
+
+	do {
+		digits[len++] = '0' + n % 10U;
+		n /= 10U;
+	} while (n != 0);
+	while (len != 0)
+		*dst++ = digits[--len];
+	return dst;
+}
+
+/*
+  Renders the line of `record` to `buf`, which holds at least KEY_ENTRY_TEXT_MAX_LINE bytes.
+  Returns its length, it is not null terminated.
+ */
+size_t		key_entry_text_format(struct key_entry_text *text, const struct keyboard_driver_record *record,
+				      char *buf)
+{
+	const struct key_entry_text_fragment	*fragment;
+	uint64_t				realtime = record->timestamp + text->realtime_offset;
+	char					*dst = buf;
+
+	if (!text->second_valid || realtime - text->second >= NSEC_PER_SEC)
+		key_entry_text_set_second(text, realtime);
+	memcpy(dst, text->prefix, KEY_ENTRY_TEXT_PREFIX_LEN);
+	dst += KEY_ENTRY_TEXT_PREFIX_LEN;
+	// The fragments are copied whole, KEY_ENTRY_TEXT_MAX_LINE leaves room for it, a copy of a constant size
+	// being a few moves instead of a call.
+	fragment = &names[record->key_id];
+	memcpy(dst, fragment->text, KEY_ENTRY_TEXT_MAX_NAME);
+	dst += fragment->len;
+	dst = put_code(dst, record->code);
+	if (record->flags & KEYBOARD_DRIVER_RECORD_REPEAT) {
+		memcpy(dst, repeated.text, KEY_ENTRY_TEXT_STATE_LEN);
+		dst = put_decimal(dst + repeated.len, record->repeats);
+		*dst++ = '\n';
+		return dst - buf;
+	}
+	fragment = &states[record->state];
+	memcpy(dst, fragment->text, KEY_ENTRY_TEXT_STATE_LEN);
+	dst += fragment->len;
+	return dst - buf;
+}
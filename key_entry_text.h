@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: GPL-2.0
+#ifndef __KEY_ENTRY_TEXT_H__
+# define __KEY_ENTRY_TEXT_H__
+
+# include "scan_code_sets.h"
+# include "keyboard_driver.h"
+
+/*
+  Text mode rendering of the records, one `HH:MM:SS name(code) state` line each, as printf() would with
+  "%02lld:%02lld:%02lld %s(%#02llx) %s\n", without any division nor format parsing per record:
+  - the `name(` fragment of every key id is built once by key_entry_text_setup()
+  - the `HH:MM:SS ` prefix is only built again once a record is past the second it was built for
+  - the code is written in hexadecimal from its number of bytes, and the state is a constant `) state\n` fragment
+  A KEYBOARD_DRIVER_RECORD_REPEAT record ends with `) Repeated count\n` instead of its state.
+ */
+
+// Longest `name(` fragment, longer names are cut
+# define KEY_ENTRY_TEXT_MAX_NAME 40U
+# define KEY_ENTRY_TEXT_PREFIX_LEN 9U
+# define KEY_ENTRY_TEXT_STATE_LEN 11U
+
+// Longest line: prefix, name fragment, 0x and 16 digits, ") Repeated " and up to 65535 repeats, "\n"
+# define KEY_ENTRY_TEXT_MAX_LINE (KEY_ENTRY_TEXT_PREFIX_LEN + KEY_ENTRY_TEXT_MAX_NAME + 18U + KEY_ENTRY_TEXT_STATE_LEN + 6U)
+
+/*
+  Formatter of a reader, which caches the prefix of the last second it rendered
+ */
+struct key_entry_text {
+	// Added to the monotonic timestamps of the records, for the wall clock
+	uint64_t	realtime_offset;
+
+	// Wall clock date, in ns, of the start of the second `prefix` was built for
+	uint64_t	second;
+	bool		second_valid;
+	char		prefix[KEY_ENTRY_TEXT_PREFIX_LEN];
+};
+
+void		key_entry_text_setup(void);
+void		key_entry_text_init(struct key_entry_text *text, uint64_t realtime_offset);
+size_t		key_entry_text_format(struct key_entry_text *text, const struct keyboard_driver_record *record,
+				      char *buf);
+
+#endif /* __KEY_ENTRY_TEXT_H__ */
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: GPL-2.0 WITH Linux-syscall-note
+#ifndef __KEYBOARD_DRIVER_H__
+# define __KEYBOARD_DRIVER_H__
+
+/*
+  Userspace interface of /dev/keyboard_driver
+ */
+
+# include <linux/types.h>
+# include <linux/ioctl.h>
+
+# define KEYBOARD_DRIVER_IOC_MAGIC 'k'
+
+enum	keyboard_driver_read_mode {
+	// One `HH:MM:SS name(code) state` line per key event, the default, `Repeated count` standing for the state of coalesced repeats
+	KEYBOARD_DRIVER_TEXT_MODE,
+	// One `struct keyboard_driver_record` per key event
+	KEYBOARD_DRIVER_BINARY_MODE
+};
+
+/*
+  Switches the reader to the enum keyboard_driver_read_mode passed as argument.
+  Fails with EBUSY once the reader started reading.
+ */
+# define KEYBOARD_DRIVER_IOC_SET_READ_MODE _IO(KEYBOARD_DRIVER_IOC_MAGIC, 1)
+
+/*
+  Coalescing of the wakeups of a reader, be it blocked in read() or in poll().
+  The reader is woken up once `batch` records are pending, or once the oldest pending record
+  has been waiting for `delay_us` microseconds, whichever comes first.
+  A `delay_us` of 0 disables the delay, the reader then only wakes up every `batch` records.
+  O_NONBLOCK reads are not affected, they return whatever is available.
+ */
+struct	keyboard_driver_wakeup {
+	__u32	batch;
+	__u32	delay_us;
+};
+
+/*
+  Sets the `struct keyboard_driver_wakeup` of the reader, the defaults come from the
+  wakeup_batch and wakeup_delay_us module parameters.
+  Fails with EINVAL if `batch` is 0 or larger than the ring.
+ */
+# define KEYBOARD_DRIVER_IOC_SET_WAKEUP _IOW(KEYBOARD_DRIVER_IOC_MAGIC, 2, struct keyboard_driver_wakeup)
+
+/*
+  Moves the cursor of a binary mode reader to the __u64 sequence number passed as argument,
+  for a process which read the records through the mapping of the ring.
+  Fails with EINVAL in text mode or if no record was produced yet at this sequence number.
+ */
+# define KEYBOARD_DRIVER_IOC_CONSUME _IOW(KEYBOARD_DRIVER_IOC_MAGIC, 3, __u64)
+
+/*
+  Fixed size record of a key event, read() only returns whole records in binary mode.
+ */
+struct	keyboard_driver_record {
+	// Date of the interrupt which completed the event, in nanoseconds of CLOCK_MONOTONIC,
+	// see struct keyboard_driver_clock for the wall clock
+	__u64	timestamp;
+
+	// Scan code of the key
+	__u64	code;
+
+	// Snapshot of the modifiers (the PS2_*_ACTIVE flags) once the event was handled
+	__u16	modifiers;
+
+	// Identifier of the key, shared by its pressed and released codes
+	__u8	key_id;
+
+	// 0 if the key was pressed, 1 if it was released
+	__u8	state;
+
+	// Ascii value of the key with the modifiers applied, if any, else 0
+	__u8	ascii_value;
+
+	// KEYBOARD_DRIVER_RECORD_* flags
+	__u8	flags;
+
+	// Number of typematic repeats of a KEYBOARD_DRIVER_RECORD_REPEAT record
+	__u16	repeats;
+};
+
+/*
+  With the coalesce_repeats parameter of the driver, the make codes the keyboard sends again while a key is held
+  are not recorded one by one. Once the run of repeats ends, with the next event, a single record with this flag
+  stands for all of them: it is the pressed record of the key, dated by the last repeat, with their number in `repeats`.
+  A run is also cut every 65535 repeats.
+ */
+# define KEYBOARD_DRIVER_RECORD_REPEAT (1U << 0U)
+
+/*
+  The device can be mapped with mmap(), from offset 0, to read the records without any syscall.
+  The mapping starts with this header, on its own page, followed by a ring of `capacity` records
+  at `records_offset`. The record of sequence number `seq` is at index `seq & (capacity - 1)`.
+  Every field is written by the driver only, the mapping must be PROT_READ, a writable one is refused with EPERM.
+
+  The driver never waits for its readers. It retains at most `limit` records, from `tail` to `head`,
+  and evicts the oldest one or drops the new one once the limit is reached, depending on its
+  drop_policy parameter. Records every reader is done with are reclaimed, moving `tail` forward.
+  A process keeps its own cursor: load `head` with acquire semantics, copy the records from
+  the cursor to `head`, issue a read barrier, then load `tail`. Records before `tail` may have been
+  overwritten while they were copied and must be discarded.
+  Report the cursor with KEYBOARD_DRIVER_IOC_CONSUME, so that the records can be reclaimed,
+  and poll() the device until it is readable once the ring is empty.
+ */
+struct	keyboard_driver_ring_header {
+	// Sequence number of the next record to be produced
+	__u64	head;
+
+	// Sequence number of the oldest retained record
+	__u64	tail;
+
+	// Number of records of the ring, a power of 2
+	__u64	capacity;
+
+	// Offset of the first record from the start of the mapping
+	__u64	records_offset;
+
+	// sizeof(struct keyboard_driver_record)
+	__u64	record_size;
+
+	// Maximum number of retained records, at most `capacity`
+	__u64	limit;
+
+	// Number of records evicted as the retention limit was reached
+	__u64	evicted;
+
+	// Number of new records dropped as the retention limit was reached
+	__u64	dropped;
+};
+
+/*
+  Retention counters of the device, and of the reader which asked for them
+ */
+struct	keyboard_driver_stats {
+	// See struct keyboard_driver_ring_header
+	__u64	head;
+	__u64	tail;
+	__u64	limit;
+	__u64	evicted;
+	__u64	dropped;
+
+	// Number of records evicted before this reader could read them
+	__u64	lost;
+};
+
+# define KEYBOARD_DRIVER_IOC_GET_STATS _IOR(KEYBOARD_DRIVER_IOC_MAGIC, 4, struct keyboard_driver_stats)
+
+/*
+  Anchor of the record timestamps to the wall clock, the dates of a same instant on both clocks:
+  wall clock date = timestamp - monotonic + realtime.
+  It is taken once, as the driver is loaded, so that converted timestamps keep the order of the records
+  even if the wall clock is set meanwhile. The text mode and the log use the same conversion.
+ */
+struct	keyboard_driver_clock {
+	// CLOCK_MONOTONIC, the clock of the record timestamps, in ns
+	__u64	monotonic;
+
+	// CLOCK_REALTIME, in ns since the epoch
+	__u64	realtime;
+};
+
+# define KEYBOARD_DRIVER_IOC_GET_CLOCK _IOR(KEYBOARD_DRIVER_IOC_MAGIC, 5, struct keyboard_driver_clock)
+
+// States of struct keyboard_driver_filter
+# define KEYBOARD_DRIVER_FILTER_PRESSED (1U << 0U)
+# define KEYBOARD_DRIVER_FILTER_RELEASED (1U << 1U)
+
+/*
+  Events a reader gets, the others are skipped by read() in both modes, they never reach userspace.
+  An event is read if all of these hold:
+  - its state is in `states`
+  - the bit of its key id is set in `key_ids`, bit `id % 64` of `key_ids[id / 64]`
+  - (modifiers & modifiers_mask) == modifiers_value, modifiers being the PS2_*_ACTIVE flags
+  - its timestamp is in [from, to], `to` being 0 for no upper bound
+  The mapping of the ring is not filtered. The skipped events still count for the wakeups of the reader,
+  which may then find nothing to read: read() waits for the next events, or fails with EAGAIN with O_NONBLOCK.
+ */
+struct	keyboard_driver_filter {
+	__u32	states;
+	__u16	modifiers_mask;
+	__u16	modifiers_value;
+	__u64	key_ids[4];
+	__u64	from;
+	__u64	to;
+};
+
+/*
+  Installs the `struct keyboard_driver_filter` of the reader, or removes it if the argument is NULL.
+  Fails with EINVAL if `states` has unknown bits, if `modifiers_value` has bits out of `modifiers_mask`
+  or if the window is empty.
+ */
+# define KEYBOARD_DRIVER_IOC_SET_FILTER _IOW(KEYBOARD_DRIVER_IOC_MAGIC, 6, struct keyboard_driver_filter)
+
+#endif /* __KEYBOARD_DRIVER_H__ */
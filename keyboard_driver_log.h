@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: GPL-2.0 WITH Linux-syscall-note
+#ifndef __KEYBOARD_DRIVER_LOG_H__
+# define __KEYBOARD_DRIVER_LOG_H__
+
+/*
+  Format of the log_file the key entries are persisted to, and of its `.idx` time index.
+
+  The log is a sequence of blocks, each a `struct keyboard_driver_log_block` followed by `size` bytes
+  of payload. The payload is LZ4 compressed if the KEYBOARD_DRIVER_LOG_LZ4 flag is set, and
+  decompresses to `raw_size` bytes encoding `records` key entries, each as:
+  - the difference between its timestamp and the one of the previous entry, the first one
+    being relative to `first_timestamp`, as a zigzag varint
+  - its scan code, as a varint
+  - its key id, on a byte
+  - a byte of KEYBOARD_DRIVER_LOG_* entry flags
+  - its modifiers, as a varint, if KEYBOARD_DRIVER_LOG_MODIFIERS is set, else they are the ones of
+    the previous entry, the first one being relative to no modifier
+  - its ascii value, on a byte, if KEYBOARD_DRIVER_LOG_ASCII is set, else it is 0
+  - its number of repeats, as a varint, if KEYBOARD_DRIVER_LOG_REPEAT is set, for the entries standing for
+    a run of typematic repeats, see KEYBOARD_DRIVER_RECORD_REPEAT. Version 1 logs have no such entry.
+  Varints are little endian base 128, 7 bits per byte with the high bit set on every byte but the last.
+
+  The index is a sequence of `struct keyboard_driver_log_index`, one per block in the order of the log,
+  so that a time range can be found without reading the blocks. It can be rebuilt from the block headers.
+ */
+
+# include <linux/types.h>
+
+# define KEYBOARD_DRIVER_LOG_MAGIC 0x4c44424bU /* "KBDL" */
+# define KEYBOARD_DRIVER_LOG_VERSION 2U
+
+// Block flags
+# define KEYBOARD_DRIVER_LOG_LZ4 (1U << 0U)
+
+// Entry flags
+# define KEYBOARD_DRIVER_LOG_RELEASED (1U << 0U)
+# define KEYBOARD_DRIVER_LOG_MODIFIERS (1U << 1U)
+# define KEYBOARD_DRIVER_LOG_ASCII (1U << 2U)
+# define KEYBOARD_DRIVER_LOG_REPEAT (1U << 3U)
+
+// Largest encoding of an entry, before compression
+# define KEYBOARD_DRIVER_LOG_MAX_ENTRY_SIZE (10U + 10U + 1U + 1U + 3U + 1U + 3U)
+
+struct	keyboard_driver_log_block {
+	__u32	magic;
+	__u16	version;
+	__u16	flags;
+
+	// Number of entries of the block
+	__u32	records;
+
+	// Size of the payload once decompressed, and as stored after this header
+	__u32	raw_size;
+	__u32	size;
+	__u32	reserved;
+
+	// Sequence number of the first entry, entries are missing from the log if they are not contiguous
+	__u64	first_seq;
+
+	// Timestamps of the first and last entries
+	__u64	first_timestamp;
+	__u64	last_timestamp;
+};
+
+struct	keyboard_driver_log_index {
+	__u64	first_timestamp;
+	__u64	last_timestamp;
+
+	// Offset of the `struct keyboard_driver_log_block` in the log
+	__u64	offset;
+};
+
+#endif /* __KEYBOARD_DRIVER_LOG_H__ */
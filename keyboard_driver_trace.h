@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: GPL-2.0
+#undef TRACE_SYSTEM
+#define TRACE_SYSTEM keyboard_driver
+
+#if !defined(__KEYBOARD_DRIVER_TRACE_H__) || defined(TRACE_HEADER_MULTI_READ)
+# define __KEYBOARD_DRIVER_TRACE_H__
+
+/*
+  Tracepoints of the decoding of the scan codes and of the reads of the device, in
+  /sys/kernel/debug/tracing/events/keyboard_driver/. They cost a static branch while disabled.
+  CREATE_TRACE_POINTS is defined by main.c only.
+ */
+
+# include <linux/tracepoint.h>
+# include "ps2_keyboard_state.h"
+
+// The formats compare against RELEASED, exported so that trace-cmd and perf can evaluate them
+TRACE_DEFINE_ENUM(RELEASED);
+
+/*
+  A byte was added to the pending code, `transition` is the state of the automaton it led to
+ */
+TRACE_EVENT(ps2_byte,
+	TP_PROTO(const struct ps2_keyboard_state *state, uint8_t code),
+	TP_ARGS(state, code),
+	TP_STRUCT__entry(
+		__field(u64,	pending_code)
+		__field(u16,	transition)
+		__field(u8,	code)
+		__field(u8,	index)
+		__field(bool,	break_pending)
+	),
+	TP_fast_assign(
+		__entry->pending_code = state->pending_code;
+		__entry->transition = state->transition;
+		__entry->code = code;
+		__entry->index = state->current_code_index;
+		__entry->break_pending = state->break_pending;
+	),
+	TP_printk("code=%#04x index=%u pending_code=%#llx transition=%#06x%s",
+		  __entry->code, __entry->index, __entry->pending_code, __entry->transition,
+		  __entry->break_pending ? " break" : "")
+);
+
+/*
+  A pending code which does not belong to the scan code set was dropped
+ */
+TRACE_EVENT(ps2_drop,
+	TP_PROTO(const struct ps2_keyboard_state *state),
+	TP_ARGS(state),
+	TP_STRUCT__entry(
+		__field(u64,	pending_code)
+	),
+	TP_fast_assign(
+		__entry->pending_code = state->pending_code;
+	),
+	TP_printk("pending_code=%#llx", __entry->pending_code)
+);
+
+TRACE_EVENT(ps2_modifier,
+	TP_PROTO(const struct ps2_keyboard_state *state, const struct scan_key_code *key),
+	TP_ARGS(state, key),
+	TP_STRUCT__entry(
+		__string(key_name,	key->key_name)
+		__field(u16,		flags)
+		__field(u8,		modifier)
+		__field(u8,		state)
+	),
+	TP_fast_assign(
+		__assign_str(key_name);
+		__entry->flags = state->flags;
+		__entry->modifier = key->modifier;
+		__entry->state = ps2_key_state(state, key);
+	),
+	TP_printk("%s %s modifier=%u flags=%#06x", __get_str(key_name),
+		  __entry->state == RELEASED ? "Released" : "Pressed", __entry->modifier, __entry->flags)
+);
+
+DECLARE_EVENT_CLASS(keyboard_driver_record,
+	TP_PROTO(uint64_t seq, const struct keyboard_driver_record *record),
+	TP_ARGS(seq, record),
+	TP_STRUCT__entry(
+		__field(u64,	seq)
+		__field(u64,	timestamp)
+		__field(u64,	code)
+		__field(u16,	modifiers)
+		__field(u16,	repeats)
+		__field(u8,	key_id)
+		__field(u8,	state)
+		__field(char,	ascii_value)
+	),
+	TP_fast_assign(
+		__entry->seq = seq;
+		__entry->timestamp = record->timestamp;
+		__entry->code = record->code;
+		__entry->modifiers = record->modifiers;
+		__entry->repeats = record->repeats;
+		__entry->key_id = record->key_id;
+		__entry->state = record->state;
+		__entry->ascii_value = record->ascii_value;
+	),
+	TP_printk("seq=%llu timestamp=%llu code=%#llx key_id=%u %s modifiers=%#06x ascii=%#04x repeats=%u",
+		  __entry->seq, __entry->timestamp, __entry->code, __entry->key_id,
+		  __entry->state == RELEASED ? "Released" : "Pressed", __entry->modifiers,
+		  (u8)__entry->ascii_value, __entry->repeats)
+);
+
+/*
+  A key entry was decoded by the interrupt thread, `seq` is the sequence number it was pushed at
+ */
+DEFINE_EVENT(keyboard_driver_record, keyboard_driver_key,
+	TP_PROTO(uint64_t seq, const struct keyboard_driver_record *record),
+	TP_ARGS(seq, record)
+);
+
+/*
+  A key entry was formatted for a reader in text mode
+ */
+DEFINE_EVENT(keyboard_driver_record, keyboard_driver_show,
+	TP_PROTO(uint64_t seq, const struct keyboard_driver_record *record),
+	TP_ARGS(seq, record)
+);
+
+#endif /* __KEYBOARD_DRIVER_TRACE_H__ */
+
+#undef TRACE_INCLUDE_PATH
+#define TRACE_INCLUDE_PATH .
+#undef TRACE_INCLUDE_FILE
+#define TRACE_INCLUDE_FILE keyboard_driver_trace
+#include <trace/define_trace.h>
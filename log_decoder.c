@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: GPL-2.0
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include "log_reader.h"
+
+/*
+  Prints the key entries of a log written by the driver, see keyboard_driver_log.h.
+  usage: log_decoder <log_file> [<from_ns> [<to_ns>]]
+  Only the blocks overlapping [from_ns, to_ns] are read and decompressed, they are found
+  through the <log_file>.idx index if there is one, else by skipping from block header to block header.
+ */
+
+struct	decoder {
+	struct log_reader	reader;
+	uint64_t		from;
+	uint64_t		to;
+};
+
+static int	print_entry(void *ctx, __u64 seq, const struct keyboard_driver_record *record)
+{
+	struct decoder	*decoder = ctx;
+	uint8_t		ascii = record->ascii_value;
+
+	if (record->timestamp < decoder->from || record->timestamp > decoder->to)
+		return 0;
+	printf("%" PRIu64 ".%09" PRIu64 " %" PRIu64 " %#" PRIx64 " %u %s %#x %c",
+		(uint64_t)record->timestamp / 1000000000, (uint64_t)record->timestamp % 1000000000,
+		(uint64_t)seq,
+		(uint64_t)record->code,
+		record->key_id,
+		record->flags & KEYBOARD_DRIVER_RECORD_REPEAT ? "Repeated"
+			: record->state ? "Released" : "Pressed",
+		record->modifiers,
+		ascii >= ' ' && ascii <= '~' ? ascii : '.');
+	if (record->flags & KEYBOARD_DRIVER_RECORD_REPEAT)
+		printf(" x%u", record->repeats);
+	printf("\n");
+	return 0;
+}
+
+/*
+  Decodes the blocks from `offset` to the end of the log or to the first one past the range
+ */
+static int	decode_from(struct decoder *decoder, off_t offset)
+{
+	struct keyboard_driver_log_block	header;
+	int					ret;
+
+	while (0 == (ret = log_reader_header(&decoder->reader, offset, &header))) {
+		offset += sizeof(header);
+		if (header.first_timestamp > decoder->to)
+			break;
+		if (header.last_timestamp >= decoder->from
+			&& log_reader_decode_block(&decoder->reader, &header, offset, &print_entry, decoder))
+			return -1;
+		offset += header.size;
+	}
+	return ret < 0 ? -1 : 0;
+}
+
+int	main(int argc, char **argv)
+{
+	struct decoder	decoder;
+	off_t		offset;
+	int		ret;
+
+	if (argc < 2 || argc > 4) {
+		dprintf(2, "usage: %s <log_file> [<from_ns> [<to_ns>]]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+	decoder.from = argc > 2 ? strtoull(argv[2], NULL, 0) : 0;
+	decoder.to = argc > 3 ? strtoull(argv[3], NULL, 0) : UINT64_MAX;
+	if (log_reader_open(&decoder.reader, argv[1]))
+		return EXIT_FAILURE;
+	offset = decoder.from != 0 ? log_reader_index_lookup(argv[1], decoder.from) : 0;
+	// Without an index, the headers are walked from the start
+	if (offset < 0)
+		offset = 0;
+	ret = decode_from(&decoder, offset);
+	log_reader_close(&decoder.reader);
+	return ret ? EXIT_FAILURE : EXIT_SUCCESS;
+}
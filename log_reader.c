@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: GPL-2.0
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <lz4.h>
+#include "log_reader.h"
+
+static const uint8_t	*get_varint(const uint8_t *src, const uint8_t *end, uint64_t *value)
+{
+	unsigned int	shift = 0;
+
+	*value = 0;
+	while (src < end && shift < 64) {
+		*value |= (uint64_t)(*src & 0x7f) << shift;
+		if (!(*src++ & 0x80))
+			return src;
+		shift += 7;
+	}
+	return NULL;
+}
+
+static int	grow(uint8_t **buf, size_t *size, size_t needed)
+{
+	uint8_t	*new;
+
+	if (needed <= *size)
+		return 0;
+	new = realloc(*buf, needed);
+	if (new == NULL)
+		return -1;
+	*buf = new;
+	*size = needed;
+	return 0;
+}
+
+/*
+  Returns 0 once `size` bytes were read, 1 at the end of the file, -1 on errors
+ */
+static int	read_at(int fd, void *buf, size_t size, off_t offset)
+{
+	ssize_t	ret;
+
+	ret = pread(fd, buf, size, offset);
+	if (ret < 0)
+		return -1;
+	return (size_t)ret == size ? 0 : 1;
+}
+
+int	log_reader_open(struct log_reader *reader, const char *path)
+{
+	memset(reader, 0, sizeof(*reader));
+	reader->fd = open(path, O_RDONLY);
+	if (reader->fd < 0) {
+		ERR("Failed to open %s", path);
+		return -1;
+	}
+	return 0;
+}
+
+void	log_reader_close(struct log_reader *reader)
+{
+	free(reader->payload);
+	free(reader->raw);
+	close(reader->fd);
+}
+
+/*
+  Reads the block header at `offset`, returns 1 at the end of the log.
+  Every version up to KEYBOARD_DRIVER_LOG_VERSION is read, version 2 only added an entry flag.
+ */
+int	log_reader_header(struct log_reader *reader, off_t offset, struct keyboard_driver_log_block *header)
+{
+	int	ret;
+
+	ret = read_at(reader->fd, header, sizeof(*header), offset);
+	if (ret != 0)
+		return ret;
+	if (header->magic != KEYBOARD_DRIVER_LOG_MAGIC || header->version == 0
+		|| header->version > KEYBOARD_DRIVER_LOG_VERSION) {
+		ERR("Invalid block header at offset %jd", (intmax_t)offset);
+		return -1;
+	}
+	return 0;
+}
+
+/*
+  Decodes the entries of the block of `header`, whose payload follows at `offset`, and passes them to `entry`
+ */
+int	log_reader_decode_block(struct log_reader *reader, const struct keyboard_driver_log_block *header, off_t offset,
+				log_reader_entry_t entry, void *ctx)
+{
+	struct keyboard_driver_record	record;
+	const uint8_t			*src;
+	const uint8_t			*end;
+	uint64_t			timestamp = header->first_timestamp;
+	uint64_t			modifiers = 0;
+	uint64_t			zigzag;
+	uint64_t			value;
+	uint8_t				flags;
+	uint32_t			i;
+	int				ret;
+
+	if (grow(&reader->payload, &reader->payload_size, header->size)
+		|| grow(&reader->raw, &reader->raw_size, header->raw_size)) {
+		ERR("Failed to allocate a block of %u bytes", header->raw_size);
+		return -1;
+	}
+	if (read_at(reader->fd, reader->payload, header->size, offset)) {
+		ERR("Truncated block at offset %jd", (intmax_t)offset);
+		return -1;
+	}
+	if (header->flags & KEYBOARD_DRIVER_LOG_LZ4) {
+		if (LZ4_decompress_safe((const char *)reader->payload, (char *)reader->raw,
+					header->size, header->raw_size) != (int)header->raw_size) {
+			ERR("Corrupted block at offset %jd", (intmax_t)offset);
+			return -1;
+		}
+		src = reader->raw;
+	} else {
+		src = reader->payload;
+	}
+	end = src + header->raw_size;
+	for (i = 0; i < header->records; i++) {
+		memset(&record, 0, sizeof(record));
+		if (NULL == (src = get_varint(src, end, &zigzag))
+			|| NULL == (src = get_varint(src, end, &value))
+			|| end - src < 2)
+			goto corrupted;
+		timestamp += (zigzag >> 1) ^ -(zigzag & 1);
+		record.timestamp = timestamp;
+		record.code = value;
+		record.key_id = *src++;
+		flags = *src++;
+		record.state = !!(flags & KEYBOARD_DRIVER_LOG_RELEASED);
+		if (flags & KEYBOARD_DRIVER_LOG_MODIFIERS) {
+			if (NULL == (src = get_varint(src, end, &modifiers)))
+				goto corrupted;
+		}
+		record.modifiers = modifiers;
+		if (flags & KEYBOARD_DRIVER_LOG_ASCII) {
+			if (src == end)
+				goto corrupted;
+			record.ascii_value = *src++;
+		}
+		if (flags & KEYBOARD_DRIVER_LOG_REPEAT) {
+			if (NULL == (src = get_varint(src, end, &value)))
+				goto corrupted;
+			record.flags = KEYBOARD_DRIVER_RECORD_REPEAT;
+			record.repeats = value;
+		}
+		ret = entry(ctx, header->first_seq + i, &record);
+		if (ret != 0)
+			return ret;
+	}
+	return 0;
+corrupted:
+	ERR("Corrupted entry %u of the block at offset %jd", i, (intmax_t)offset);
+	return -1;
+}
+
+/*
+  Offset of the first block which may hold entries from `from`, by a binary search of the index.
+  Returns -1 if there is no usable index.
+ */
+off_t	log_reader_index_lookup(const char *log_path, __u64 from)
+{
+	struct keyboard_driver_log_index	entry;
+	char					*index_path;
+	size_t					count;
+	size_t					low;
+	size_t					high;
+	size_t					mid;
+	int					fd;
+
+	if (asprintf(&index_path, "%s.idx", log_path) < 0)
+		return -1;
+	fd = open(index_path, O_RDONLY);
+	free(index_path);
+	if (fd < 0)
+		return -1;
+	count = lseek(fd, 0, SEEK_END) / (off_t)sizeof(entry);
+	if (count == 0) {
+		close(fd);
+		return -1;
+	}
+	low = 0;
+	high = count;
+	while (low < high) {
+		mid = low + (high - low) / 2;
+		if (read_at(fd, &entry, sizeof(entry), mid * sizeof(entry))) {
+			close(fd);
+			return -1;
+		}
+		if (entry.last_timestamp < from)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	// The blocks after the last indexed one are walked, in case their index entries were not written
+	if (low == count)
+		low = count - 1;
+	if (read_at(fd, &entry, sizeof(entry), low * sizeof(entry)))
+		entry.offset = -1;
+	close(fd);
+	return entry.offset;
+}
@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: GPL-2.0
+#ifndef __LOG_READER_H__
+# define __LOG_READER_H__
+
+# include <stdio.h>
+# include <sys/types.h>
+# include "keyboard_driver.h"
+# include "keyboard_driver_log.h"
+
+/*
+  Userspace reader of the log written by the driver and of its index, see keyboard_driver_log.h,
+  shared by log_decoder, ps2_replay and the unit tests.
+  The entries are decoded back to `struct keyboard_driver_record`, dated by the wall clock as they were logged.
+ */
+
+# define ERR(format, ...) do {						\
+		dprintf(2, "%s:%d " format "\n", __FILE__, __LINE__ __VA_OPT__(,) __VA_ARGS__); \
+	} while (0)
+
+struct	log_reader {
+	int		fd;
+	__u8		*payload;
+	__u8		*raw;
+	size_t		payload_size;
+	size_t		raw_size;
+};
+
+/*
+  Called on every entry of a block with its sequence number, decoding stops at the first non 0 return
+ */
+typedef int	(*log_reader_entry_t)(void *ctx, __u64 seq, const struct keyboard_driver_record *record);
+
+int	log_reader_open(struct log_reader *reader, const char *path);
+void	log_reader_close(struct log_reader *reader);
+int	log_reader_header(struct log_reader *reader, off_t offset, struct keyboard_driver_log_block *header);
+int	log_reader_decode_block(struct log_reader *reader, const struct keyboard_driver_log_block *header, off_t offset,
+				log_reader_entry_t entry, void *ctx);
+off_t	log_reader_index_lookup(const char *log_path, __u64 from);
+
+#endif /* __LOG_READER_H__ */
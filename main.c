@@ -13,14 +13,42 @@
 #include <linux/ioport.h>
 #include <linux/interrupt.h>
 #include <linux/miscdevice.h>
-#include <linux/seq_file.h>
+#include <linux/uio.h>
+#include <linux/slab.h>
+#include <linux/mutex.h>
 #include <linux/fcntl.h>
 #include <linux/file.h>
+#include <linux/kfifo.h>
+#include <linux/mm.h>
+#include <linux/poll.h>
+#include <linux/hrtimer.h>
+#include <linux/ktime.h>
+#include <linux/debugfs.h>
+#include <linux/jump_label.h>
+#include <linux/version.h>
 #include "scan_code_sets.h"
 #include "ps2_keyboard_state.h"
+#include "key_entry_ring.h"
+#include "key_entry_log.h"
+#include "key_entry_latency.h"
+#include "key_entry_text.h"
+#include "key_entry_filter.h"
+#include "keyboard_driver.h"
+#define CREATE_TRACE_POINTS
+#include "keyboard_driver_trace.h"
 #include <linux/syscalls.h>
 #include <linux/kallsyms.h>
 
+/*
+  Oldest kernel the module builds against:
+  vm_flags_clear() of the read only mmap() of the ring is Linux 6.3 or later,
+  the one argument __assign_str() of the tracepoints is Linux 6.10 or later,
+  hrtimer_setup() of the wakeup deadlines is Linux 6.13 or later
+ */
+#if LINUX_VERSION_CODE < KERNEL_VERSION(6, 13, 0)
+# error "keyboard_driver needs Linux 6.13 or later"
+#endif
+
 MODULE_AUTHOR("sclolus");
 MODULE_ALIAS("keyboard_driver");
 MODULE_LICENSE("GPL v2");
@@ -29,18 +57,95 @@ MODULE_LICENSE("GPL v2");
 #define LOG MODULE_NAME ": "
 
 #define KEYBOARD_IOPORT 0x60
+#define KEYBOARD_STATUS_IOPORT 0x64
+// Bits of the i8042 status register: a byte is waiting in the output buffer, and it comes from the aux port
+#define KEYBOARD_STATUS_OBF (1U << 0U)
+#define KEYBOARD_STATUS_AUXDATA (1U << 5U)
 #define PS2_DEFAULT_IRQ 1
 #define DRIVER_DEFAULT_MINOR 42
+#define DRIVER_DEFAULT_RING_SIZE 4096
+#define RAW_CODES_FIFO_SIZE 256
+#define DRIVER_DEFAULT_WAKEUP_BATCH 1
+#define DRIVER_DEFAULT_WAKEUP_DELAY_US 0
+#define DRIVER_DEFAULT_LOG_BATCH 256
+#define DRIVER_DEFAULT_LOG_FLUSH_MS 1000
+#define DRIVER_READ_BUFFER_SIZE PAGE_SIZE
 
 static unsigned int	minor = 0;
 static uint32_t		irq = 0;
 static char		*log_file = "/tmp/keylogger_file";
-
-DEFINE_MUTEX(open_mutex);
+static unsigned int	ring_size = DRIVER_DEFAULT_RING_SIZE;
+static unsigned int	wakeup_batch = DRIVER_DEFAULT_WAKEUP_BATCH;
+static unsigned int	wakeup_delay_us = DRIVER_DEFAULT_WAKEUP_DELAY_US;
+static unsigned int	retain_events = 0;
+static unsigned long	retain_bytes = 0;
+static char		*drop_policy = "oldest";
+static unsigned int	log_batch = DRIVER_DEFAULT_LOG_BATCH;
+static unsigned int	log_flush_ms = DRIVER_DEFAULT_LOG_FLUSH_MS;
+static char		*log_fsync = "close";
+static unsigned int	scan_code_set = 1;
+static bool		coalesce_repeats = false;
 
 module_param(irq, uint, 0444);
 module_param(minor, uint, 0444);
 module_param(log_file, charp, 0444);
+MODULE_PARM_DESC(log_file, "File the key entries are appended to, empty to disable the log");
+module_param(log_batch, uint, 0444);
+MODULE_PARM_DESC(log_batch, "Number of pending key entries for which the log is written right away");
+module_param(log_flush_ms, uint, 0444);
+MODULE_PARM_DESC(log_flush_ms, "Maximum delay before a pending key entry is written to the log");
+module_param(log_fsync, charp, 0444);
+MODULE_PARM_DESC(log_fsync, "When the log is synced to its storage: \"never\", as it is \"close\"d, or after every \"flush\"");
+module_param(ring_size, uint, 0444);
+MODULE_PARM_DESC(ring_size, "Capacity of the key entry ring, rounded up to a power of 2");
+module_param(retain_events, uint, 0444);
+MODULE_PARM_DESC(retain_events, "Maximum number of key entries retained for the readers, 0 for the capacity of the ring");
+module_param(retain_bytes, ulong, 0444);
+MODULE_PARM_DESC(retain_bytes, "Maximum size of the key entries retained for the readers, 0 for no limit");
+module_param(drop_policy, charp, 0444);
+MODULE_PARM_DESC(drop_policy, "Once the retention limit is reached, either evict the \"oldest\" key entry or drop the \"newest\" one");
+module_param(scan_code_set, uint, 0444);
+MODULE_PARM_DESC(scan_code_set, "Scan code set sent by the keyboard: 1 behind the i8042 translation, else the 2 or 3 it is set to");
+module_param(coalesce_repeats, bool, 0444);
+MODULE_PARM_DESC(coalesce_repeats, "Record the typematic repeats of a held key as one key entry with their count");
+module_param(wakeup_batch, uint, 0644);
+MODULE_PARM_DESC(wakeup_batch, "Default number of pending key entries a reader is woken up for");
+module_param(wakeup_delay_us, uint, 0644);
+MODULE_PARM_DESC(wakeup_delay_us, "Default maximum delay before a reader is woken up for a pending key entry, 0 for none");
+
+/*
+  Gates the printk() of every key entry and of every read, which cost a static branch while disabled.
+  The keyboard_driver tracepoints are the cheaper way to observe the decoder.
+ */
+static DEFINE_STATIC_KEY_FALSE(driver_debug);
+
+static int	param_set_debug(const char *val, const struct kernel_param *kp)
+{
+	bool	enable;
+	int	ret;
+
+	ret = kstrtobool(val, &enable);
+	if (ret)
+		return ret;
+	if (enable)
+		static_branch_enable(&driver_debug);
+	else
+		static_branch_disable(&driver_debug);
+	return 0;
+}
+
+static int	param_get_debug(char *buffer, const struct kernel_param *kp)
+{
+	return sprintf(buffer, "%c\n", static_key_enabled(&driver_debug) ? 'Y' : 'N');
+}
+
+static const struct kernel_param_ops	param_ops_debug = {
+	.set = &param_set_debug,
+	.get = &param_get_debug,
+};
+
+module_param_cb(debug, &param_ops_debug, NULL, 0644);
+MODULE_PARM_DESC(debug, "Print every key entry and every read to the kernel log");
 
 static const struct usb_device_id usb_module_id_table[2] = {
 	{ USB_INTERFACE_INFO(
@@ -52,631 +157,370 @@ static const struct usb_device_id usb_module_id_table[2] = {
 MODULE_DEVICE_TABLE(usb, usb_module_id_table);
 
 
+struct	driver_data {
+	struct miscdevice	device;
+	struct key_entry_ring	ring;
+	struct key_entry_log	log;
+
+	// Latency of each stage between the interrupt and the readers, in debugfs/keyboard_driver/latency
+	struct key_entry_latency	latency;
+	struct dentry		*debugfs;
+
+	// Every open `struct driver_reader`, whose cursors tell which entries can be reclaimed
+	struct list_head	readers;
+	spinlock_t		readers_lock;
 
-DECLARE_WAIT_QUEUE_HEAD(read_wqueue);
+	// Wall clock anchor of the record timestamps, taken as the driver is loaded
+	struct keyboard_driver_clock	clock;
+};
 
-static LIST_HEAD(key_entry_list);
-static DEFINE_SPINLOCK(key_list_spinlock);
-static DEFINE_SEMAPHORE(key_list_semaphore);
+/*
+  Operational counters, per CPU so that updating one is a single this_cpu_inc(), even from the interrupt handler.
+  They are summed as they are read, through the attributes of the misc device in counters/.
+ */
+struct	driver_counters {
+	// Bytes read from the device by the interrupt handler
+	u64	bytes_received;
 
+	// Key entries decoded
+	u64	events;
 
-struct	driver_data {
-	struct miscdevice   device;
-	struct key_entry    *entries;
+	// Pending codes which did not belong to the scan code set, and the bytes they were made of
+	u64	unknown_codes;
+	u64	dropped_bytes;
+
+	// Allocations which failed, leaving a feature or a reader out
+	u64	alloc_failures;
+
+	// Bytes lost in the raw fifo as the interrupt thread lagged behind the interrupt handler,
+	// the key entries the retention limit drops or evicts are counted by the ring itself
+	u64	overflows;
+
+	// Readers woken up for pending key entries
+	u64	wakeups;
+
+	// Key entries skipped by the filter of a reader
+	u64	filtered;
+
+	// Typematic repeats counted in a KEYBOARD_DRIVER_RECORD_REPEAT key entry instead of being recorded
+	u64	coalesced;
+};
+
+static DEFINE_PER_CPU(struct driver_counters, driver_counters);
+
+/*
+  Byte read from the device by the interrupt handler, along with the monotonic date of the interrupt, in ns.
+  It becomes the timestamp of the record the byte completes, and starts the latency histograms.
+ */
+struct	raw_code {
+	u64		irq;
+	uint8_t		code;
+};
+
+/*
+  Single producer (the interrupt handler), single consumer (the interrupt thread) fifo
+ */
+static DEFINE_KFIFO(raw_codes, struct raw_code, RAW_CODES_FIFO_SIZE);
+
+struct	driver_reader {
+	struct list_head	node;
+
+	// Serializes the reads and the moves of the cursor
+	struct mutex		lock;
+
+	// enum keyboard_driver_read_mode
+	int		mode;
+
+	// Whether read() was called, after which the mode cannot change anymore
+	bool		started;
+
+	// Next entry to be read, the reader only loses its own entries if it lags behind
+	struct key_entry_cursor		cursor;
+
+	// Entries the reader gets, see struct keyboard_driver_filter
+	struct key_entry_filter		filter;
+
+	// Staging page of the reads, for the text lines or for the records which passed the filter
+	char				*buf;
+
+	// Text mode lines rendered from the entries before the cursor, from `text_off` to `text_len` are left to read
+	struct key_entry_text		text;
+	size_t				text_len;
+	size_t				text_off;
+
+	// Only woken up by the interrupt thread once the reader is ready, see driver_wake_readers()
+	wait_queue_head_t	wqueue;
+
+	// Wakeup coalescing, see struct keyboard_driver_wakeup
+	uint64_t	wakeup_batch;
+	u64		wakeup_delay;
+
+	// Date at which the reader is to be woken up for the pending entry of sequence `deadline_seq`.
+	// The deadline is armed by the interrupt thread, read() and poll(), hence its own lock.
+	spinlock_t	deadline_lock;
+	ktime_t		deadline;
+	uint64_t	deadline_seq;
+	struct hrtimer	deadline_timer;
+
+	// Monotonic date at which the reader was last woken up for the entry of sequence `woken_seq`,
+	// 0 once read or if the read did not sleep
+	u64		woken;
+	uint64_t	woken_seq;
 };
 
 static struct driver_data  driver_data;
 
 static int	driver_release(struct inode *inode, struct file *file);
 static int	driver_open(struct inode *inode, struct file *file);
+static ssize_t	driver_read_iter(struct kiocb *iocb, struct iov_iter *to);
+static long	driver_ioctl(struct file *file, unsigned int cmd, unsigned long arg);
+static int	driver_mmap(struct file *file, struct vm_area_struct *vma);
+static __poll_t	driver_poll(struct file *file, poll_table *wait);
 static const struct file_operations	device_fops = {
 	.owner = THIS_MODULE,
 	.open = &driver_open,
 	.release = &driver_release,
-	.read = &seq_read,
-	.llseek = //&no_llseek,
-	seq_lseek, //maybe ?
-};
-
-static void	*driver_seq_start(struct seq_file *seq_file, loff_t *pos);
-static int	driver_seq_show(struct seq_file *seq_file, void *v);
-static void	driver_seq_stop(struct seq_file *seq_file, void *v);
-static void	*driver_seq_next(struct seq_file *seq_file, void *v, loff_t *pos);
-
-static const struct seq_operations  seq_ops = {
-	.start = driver_seq_start,
-	.next  = driver_seq_next,
-	.stop  = driver_seq_stop,
-	.show  = driver_seq_show,
-};
-
-struct scan_key_code	scan_code_set_1[] = {
-	{ 0x1, "escape", PRESSED, 0x0 },
-	{ 0x2, "1", PRESSED, '1' },
-	{ 0x3, "2", PRESSED, '2' },
-	{ 0x4, "3", PRESSED, '3' },
-	{ 0x5, "4", PRESSED, '4' },
-	{ 0x6, "5", PRESSED, '5' },
-	{ 0x7, "6", PRESSED, '6' },
-	{ 0x8, "7", PRESSED, '7' },
-	{ 0x9, "8", PRESSED, '8' },
-	{ 0xa, "9", PRESSED, '9' },
-	{ 0xb, "0 (zero)", PRESSED, '0' },
-	{ 0xc, "-", PRESSED, '-' },
-	{ 0xd, "=", PRESSED, '=' },
-	{ 0xe, "backspace", PRESSED, 0x0 },
-	{ 0xf, "tab", PRESSED, '\t' },
-	{ 0x10, "Q", PRESSED, 'q' },
-	{ 0x11, "W", PRESSED, 'w' },
-	{ 0x12, "E", PRESSED, 'e' },
-	{ 0x13, "R", PRESSED, 'r' },
-	{ 0x14, "T", PRESSED, 't' },
-	{ 0x15, "Y", PRESSED, 'y' },
-	{ 0x16, "U", PRESSED, 'u' },
-	{ 0x17, "I", PRESSED, 'i' },
-	{ 0x18, "O", PRESSED, 'o' },
-	{ 0x19, "P", PRESSED, 'p' },
-	{ 0x1a, "[", PRESSED, '[' },
-	{ 0x1b, "]", PRESSED, ']' },
-	{ 0x1c, "enter", PRESSED, '\n' }, // I mean yeah
-	{ 0x1d, "left control", PRESSED, 0x0 },
-	{ 0x1e, "A", PRESSED, 'a' },
-	{ 0x1f, "S", PRESSED, 's' },
-	{ 0x20, "D", PRESSED, 'd' },
-	{ 0x21, "F", PRESSED, 'f' },
-	{ 0x22, "G", PRESSED, 'g' },
-	{ 0x23, "H", PRESSED, 'h' },
-	{ 0x24, "J", PRESSED, 'j' },
-	{ 0x25, "K", PRESSED, 'k' },
-	{ 0x26, "L", PRESSED, 'l' },
-	{ 0x27, ";", PRESSED, ';' },
-	{ 0x28, "' (single quote)", PRESSED, '\'' },
-	{ 0x29, "` (back tick)", PRESSED, '`' },
-	{ 0x2a, "left shift", PRESSED, 0x0 },
-	{ 0x2b, "\\", PRESSED, '\\' },
-	{ 0x2c, "Z", PRESSED, 'z' },
-	{ 0x2d, "X", PRESSED, 'x' },
-	{ 0x2e, "C", PRESSED, 'c' },
-	{ 0x2f, "V", PRESSED, 'v' },
-	{ 0x30, "B", PRESSED, 'b' },
-	{ 0x31, "N", PRESSED, 'n' },
-	{ 0x32, "M", PRESSED, 'm' },
-	{ 0x33, ",", PRESSED, ',' },
-	{ 0x34, ".", PRESSED, '.' },
-	{ 0x35, "/", PRESSED, '/' },
-	{ 0x36, "right shift", PRESSED, 0x0 },
-	{ 0x37, "(keypad) *", PRESSED, '*' },
-	{ 0x38, "left alt", PRESSED, 0x0 },
-	{ 0x39, "space", PRESSED, ' ' },
-	{ 0x3a, "CapsLock", PRESSED, 0x0 },
-	{ 0x3b, "F1", PRESSED, 0x0 },
-	{ 0x3c, "F2", PRESSED, 0x0 },
-	{ 0x3d, "F3", PRESSED, 0x0 },
-	{ 0x3e, "F4", PRESSED, 0x0 },
-	{ 0x3f, "F5", PRESSED, 0x0 },
-	{ 0x40, "F6", PRESSED, 0x0 },
-	{ 0x41, "F7", PRESSED, 0x0 },
-	{ 0x42, "F8", PRESSED, 0x0 },
-	{ 0x43, "F9", PRESSED, 0x0 },
-	{ 0x44, "F10", PRESSED, 0x0 },
-	{ 0x45, "NumberLock", PRESSED, 0x0 },
-	{ 0x46, "ScrollLock", PRESSED, 0x0 },
-	{ 0x47, "(keypad) 7", PRESSED, '7' },
-	{ 0x48, "(keypad) 8", PRESSED, '8' },
-	{ 0x49, "(keypad) 9", PRESSED, '9' },
-	{ 0x4a, "(keypad) -", PRESSED, '-' },
-	{ 0x4b, "(keypad) 4", PRESSED, '4' },
-	{ 0x4c, "(keypad) 5", PRESSED, '5' },
-	{ 0x4d, "(keypad) 6", PRESSED, '6' },
-	{ 0x4e, "(keypad) +", PRESSED, '+' },
-	{ 0x4f, "(keypad) 1", PRESSED, '1' },
-	{ 0x50, "(keypad) 2", PRESSED, '2' },
-	{ 0x51, "(keypad) 3", PRESSED, '3' },
-	{ 0x52, "(keypad) 0", PRESSED, '0' },
-	{ 0x53, "(keypad) .", PRESSED, '.' },
-	{ 0x57, "F11", PRESSED, 0x0 },
-	{ 0x58, "F12", PRESSED, 0x0 },
-	{ 0x81, "escape", RELEASED, 0x0 },
-	{ 0x82, "1", RELEASED, '1' },
-	{ 0x83, "2", RELEASED, '2' },
-	{ 0x84, "3", RELEASED, '3' },
-	{ 0x85, "4", RELEASED, '4' },
-	{ 0x86, "5", RELEASED, '5' },
-	{ 0x87, "6", RELEASED, '6' },
-	{ 0x88, "7", RELEASED, '6' },
-	{ 0x89, "8", RELEASED, '8' },
-	{ 0x8a, "9", RELEASED, '9' },
-	{ 0x8b, "0 (zero)", RELEASED, '0' },
-	{ 0x8c, "-", RELEASED, '-' },
-	{ 0x8d, "=", RELEASED, '=' },
-	{ 0x8e, "backspace", RELEASED, 0x0 },
-	{ 0x8f, "tab", RELEASED, '\t' },
-	{ 0x90, "Q", RELEASED, 'q' },
-	{ 0x91, "W", RELEASED, 'w' },
-	{ 0x92, "E", RELEASED, 'e' },
-	{ 0x93, "R", RELEASED, 'r' },
-	{ 0x94, "T", RELEASED, 't' },
-	{ 0x95, "Y", RELEASED, 'y' },
-	{ 0x96, "U", RELEASED, 'u' },
-	{ 0x97, "I", RELEASED, 'i' },
-	{ 0x98, "O", RELEASED, 'o' },
-	{ 0x99, "P", RELEASED, 'p' },
-	{ 0x9a, "[", RELEASED, '[' },
-	{ 0x9b, "]", RELEASED, ']' },
-	{ 0x9c, "enter", RELEASED, '\n' },
-	{ 0x9d, "left control", RELEASED, 0x0 },
-	{ 0x9e, "A", RELEASED, 'a' },
-	{ 0x9f, "S", RELEASED, 's' },
-	{ 0xa0, "D", RELEASED, 'd' },
-	{ 0xa1, "F", RELEASED, 'f' },
-	{ 0xa2, "G", RELEASED, 'g' },
-	{ 0xa3, "H", RELEASED, 'h' },
-	{ 0xa4, "J", RELEASED, 'j' },
-	{ 0xa5, "K", RELEASED, 'k' },
-	{ 0xa6, "L", RELEASED, 'l' },
-	{ 0xa7, ";", RELEASED, ';' },
-	{ 0xa8, "' (single quote)", RELEASED, '\'' },
-	{ 0xa9, "` (back tick)", RELEASED, '`' },
-	{ 0xaa, "left shift", RELEASED, 0x0 },
-	{ 0xab, "\\", RELEASED, '\\' },
-	{ 0xac, "Z", RELEASED, 'z' },
-	{ 0xad, "X", RELEASED, 'x' },
-	{ 0xae, "C", RELEASED, 'c' },
-	{ 0xaf, "V", RELEASED, 'v' },
-	{ 0xb0, "B", RELEASED, 'b' },
-	{ 0xb1, "N", RELEASED, 'n' },
-	{ 0xb2, "M", RELEASED, 'm' },
-	{ 0xb3, ",", RELEASED, ',' },
-	{ 0xb4, ".", RELEASED, '.' },
-	{ 0xb5, "/", RELEASED, '/' },
-	{ 0xb6, "right shift", RELEASED, 0x0 },
-	{ 0xb7, "(keypad) *", RELEASED, '*' },
-	{ 0xb8, "left alt", RELEASED, 0x0 },
-	{ 0xb9, "space", RELEASED, ' ' },
-	{ 0xba, "CapsLock", RELEASED, 0x0 },
-	{ 0xbb, "F1", RELEASED, 0x0 },
-	{ 0xbc, "F2", RELEASED, 0x0 },
-	{ 0xbd, "F3", RELEASED, 0x0 },
-	{ 0xbe, "F4", RELEASED, 0x0 },
-	{ 0xbf, "F5", RELEASED, 0x0 },
-	{ 0xc0, "F6", RELEASED, 0x0 },
-	{ 0xc1, "F7", RELEASED, 0x0 },
-	{ 0xc2, "F8", RELEASED, 0x0 },
-	{ 0xc3, "F9", RELEASED, 0x0 },
-	{ 0xc4, "F10", RELEASED, 0x0 },
-	{ 0xc5, "NumberLock", RELEASED, 0x0 },
-	{ 0xc6, "ScrollLock", RELEASED, 0x0 },
-	{ 0xc7, "(keypad) 7", RELEASED, '7' },
-	{ 0xc8, "(keypad) 8", RELEASED, '8' },
-	{ 0xc9, "(keypad) 9", RELEASED, '9' },
-	{ 0xca, "(keypad) -", RELEASED, '-' },
-	{ 0xcb, "(keypad) 4", RELEASED, '4' },
-	{ 0xcc, "(keypad) 5", RELEASED, '5' },
-	{ 0xcd, "(keypad) 6", RELEASED, '6' },
-	{ 0xce, "(keypad) +", RELEASED, '+' },
-	{ 0xcf, "(keypad) 1", RELEASED, '1' },
-	{ 0xd0, "(keypad) 2", RELEASED, '2' },
-	{ 0xd1, "(keypad) 3", RELEASED, '4' },
-	{ 0xd2, "(keypad) 0", RELEASED, '0' },
-	{ 0xd3, "(keypad) .", RELEASED, '.' },
-	{ 0xd7, "F11", RELEASED, 0x0 },
-	{ 0xd8, "F12", RELEASED, 0x0 },
-	{ 0xe010, "(multimedia) previous track", PRESSED, 0x0 },
-	{ 0xe019, "(multimedia) next track", PRESSED, 0x0 },
-	{ 0xe01c, "(keypad) enter", PRESSED, '\n' },
-	{ 0xe01d, "right control", PRESSED, 0x0 },
-	{ 0xe020, "(multimedia) mute", PRESSED, 0x0 },
-	{ 0xe021, "(multimedia) calculator", PRESSED, 0x0 },
-	{ 0xe022, "(multimedia) play", PRESSED, 0x0 },
-	{ 0xe024, "(multimedia) stop", PRESSED, 0x0 },
-	{ 0xe02e, "(multimedia) volume down", PRESSED, 0x0 },
-	{ 0xe030, "(multimedia) volume up", PRESSED, 0x0 },
-	{ 0xe032, "(multimedia) WWW home", PRESSED, 0x0 },
-	{ 0xe035, "(keypad) /", PRESSED, '/' },
-	{ 0xe038, "right alt (or altGr)", PRESSED, 0x0 },
-	{ 0xe047, "home", PRESSED, 0x0 },
-	{ 0xe048, "cursor up", PRESSED, 0x0 },
-	{ 0xe049, "page up", PRESSED, 0x0 },
-	{ 0xe04b, "cursor left", PRESSED, 0x0 },
-	{ 0xe04d, "cursor right", PRESSED, 0x0 },
-	{ 0xe04f, "end", PRESSED, 0x0 },
-	{ 0xe050, "cursor down", PRESSED, 0x0 },
-	{ 0xe051, "page down", PRESSED, 0x0 },
-	{ 0xe052, "insert", PRESSED, 0x0 },
-	{ 0xe053, "delete", PRESSED, 0x0 },
-	{ 0xe05b, "left GUI", PRESSED, 0x0 },
-	{ 0xe05c, "right GUI", PRESSED, 0x0 },
-	{ 0xe05d, "\"apps\"", PRESSED, 0x0 },
-	{ 0xe05e, "(ACPI) power", PRESSED, 0x0 },
-	{ 0xe05f, "(ACPI) sleep", PRESSED, 0x0 },
-	{ 0xe063, "(ACPI) wake", PRESSED, 0x0 },
-	{ 0xe065, "(multimedia) WWW search", PRESSED, 0x0 },
-	{ 0xe066, "(multimedia) WWW favorites", PRESSED, 0x0 },
-	{ 0xe067, "(multimedia) WWW refresh", PRESSED, 0x0 },
-	{ 0xe068, "(multimedia) WWW stop", PRESSED, 0x0 },
-	{ 0xe069, "(multimedia) WWW forward", PRESSED, 0x0 },
-	{ 0xe06a, "(multimedia) WWW back", PRESSED, 0x0 },
-	{ 0xe06b, "(multimedia) my computer", PRESSED, 0x0 },
-	{ 0xe06c, "(multimedia) email", PRESSED, 0x0 },
-	{ 0xe06d, "(multimedia) media select", PRESSED, 0x0 },
-	{ 0xe090, "(multimedia) previous track", RELEASED, 0x0 },
-	{ 0xe099, "(multimedia) next track", RELEASED, 0x0 },
-	{ 0xe09c, "(keypad) enter", RELEASED, '\n' },
-	{ 0xe09d, "right control", RELEASED, 0x0 },
-	{ 0xe0a0, "(multimedia) mute", RELEASED, 0x0 },
-	{ 0xe0a1, "(multimedia) calculator", RELEASED, 0x0 },
-	{ 0xe0a2, "(multimedia) play", RELEASED, 0x0 },
-	{ 0xe0a4, "(multimedia) stop", RELEASED, 0x0 },
-	{ 0xe0ae, "(multimedia) volume down", RELEASED, 0x0 },
-	{ 0xe0b0, "(multimedia) volume up", RELEASED, 0x0 },
-	{ 0xe0b2, "(multimedia) WWW home", RELEASED, 0x0 },
-	{ 0xe0b5, "(keypad) /", RELEASED, '/' },
-	{ 0xe0b8, "right alt (or altGr)", RELEASED, 0x0 },
-	{ 0xe0c7, "home", RELEASED, 0x0 },
-	{ 0xe0c8, "cursor up", RELEASED, 0x0 },
-	{ 0xe0c9, "page up", RELEASED, 0x0 },
-	{ 0xe0cb, "cursor left", RELEASED, 0x0 },
-	{ 0xe0cd, "cursor right", RELEASED, 0x0 },
-	{ 0xe0cf, "end", RELEASED, 0x0 },
-	{ 0xe0d0, "cursor down", RELEASED, 0x0 },
-	{ 0xe0d1, "page down", RELEASED, 0x0 },
-	{ 0xe0d2, "insert", RELEASED, 0x0 },
-	{ 0xe0d3, "delete", RELEASED, 0x0 },
-	{ 0xe0db, "left GUI", RELEASED, 0x0 },
-	{ 0xe0dc, "right GUI", RELEASED, 0x0 },
-	{ 0xe0dd, "\"apps\"", RELEASED, 0x0 },
-	{ 0xe0de, "(ACPI) power", RELEASED, 0x0 },
-	{ 0xe0df, "(ACPI) sleep", RELEASED, 0x0 },
-	{ 0xe0e3, "(ACPI) wake", RELEASED, 0x0 },
-	{ 0xe0e5, "(multimedia) WWW search", RELEASED, 0x0 },
-	{ 0xe0e6, "(multimedia) WWW favorites", RELEASED, 0x0 },
-	{ 0xe0e7, "(multimedia) WWW refresh", RELEASED, 0x0 },
-	{ 0xe0e8, "(multimedia) WWW stop", RELEASED, 0x0 },
-	{ 0xe0e9, "(multimedia) WWW forward", RELEASED, 0x0 },
-	{ 0xe0ea, "(multimedia) WWW back", RELEASED, 0x0 },
-	{ 0xe0eb, "(multimedia) my computer", RELEASED, 0x0 },
-	{ 0xe0ec, "(multimedia) email", RELEASED, 0x0 },
-	{ 0xe0ed, "(multimedia) media select", RELEASED, 0x0 },
-	{ 0xe02ae037, "print screen", PRESSED, 0x0 },
-	{ 0xe0b7e0aa, "print screen", RELEASED, 0x0 },
-	{ 0xe11d45e19dc5, "pause", PRESSED, 0x0 },
-};
-
-struct scan_key_code scan_code_set_2[] = {
-	{ 0x1, "escape", PRESSED, 0x0 },
-	{ 0x2, "1", PRESSED, '1' },
-	{ 0x3, "2", PRESSED, '2' },
-	{ 0x4, "3", PRESSED, '3' },
-	{ 0x5, "4", PRESSED, '4' },
-	{ 0x6, "5", PRESSED, '5' },
-	{ 0x7, "6", PRESSED, '6' },
-	{ 0x8, "7", PRESSED, '7' },
-	{ 0x9, "8", PRESSED, '8' },
-	{ 0xa, "9", PRESSED, '9' },
-	{ 0xb, "0 (zero)", PRESSED, '0' },
-	{ 0xc, "-", PRESSED, '-' },
-	{ 0xd, "=", PRESSED, '=' },
-	{ 0xe, "backspace", PRESSED, 0x0 },
-	{ 0xf, "tab", PRESSED, '\t' },
-	{ 0x10, "Q", PRESSED, 'q' },
-	{ 0x11, "W", PRESSED, 'w' },
-	{ 0x12, "E", PRESSED, 'e' },
-	{ 0x13, "R", PRESSED, 'r' },
-	{ 0x14, "T", PRESSED, 't' },
-	{ 0x15, "Y", PRESSED, 'y' },
-	{ 0x16, "U", PRESSED, 'u' },
-	{ 0x17, "I", PRESSED, 'i' },
-	{ 0x18, "O", PRESSED, 'o' },
-	{ 0x19, "P", PRESSED, 'p' },
-	{ 0x1a, "[", PRESSED, '[' },
-	{ 0x1b, "]", PRESSED, ']' },
-	{ 0x1c, "enter", PRESSED, '\n' },
-	{ 0x1d, "left control", PRESSED, 0x0 },
-	{ 0x1e, "A", PRESSED, 'a' },
-	{ 0x1f, "S", PRESSED, 's' },
-	{ 0x20, "D", PRESSED, 'd' },
-	{ 0x21, "F", PRESSED, 'f' },
-	{ 0x22, "G", PRESSED, 'g' },
-	{ 0x23, "H", PRESSED, 'h' },
-	{ 0x24, "J", PRESSED, 'j' },
-	{ 0x25, "K", PRESSED, 'k' },
-	{ 0x26, "L", PRESSED, 'l' },
-	{ 0x27, ";", PRESSED, ';' },
-	{ 0x28, "' (single quote)", PRESSED, '\'' },
-	{ 0x29, "` (back tick)", PRESSED, '`' },
-	{ 0x2a, "left shift", PRESSED, 0x0 },
-	{ 0x2b, "\\", PRESSED, '\\' },
-	{ 0x2c, "Z", PRESSED, 'z' },
-	{ 0x2d, "X", PRESSED, 'x' },
-	{ 0x2e, "C", PRESSED, 'c' },
-	{ 0x2f, "V", PRESSED, 'v' },
-	{ 0x30, "B", PRESSED, 'b' },
-	{ 0x31, "N", PRESSED, 'n' },
-	{ 0x32, "M", PRESSED, 'm' },
-	{ 0x33, ",", PRESSED, ',' },
-	{ 0x34, ".", PRESSED, '.' },
-	{ 0x35, "/", PRESSED, '/' },
-	{ 0x36, "right shift", PRESSED, 0x0 },
-	{ 0x37, "(keypad) *", PRESSED, '*' },
-	{ 0x38, "left alt", PRESSED, 0x0 },
-	{ 0x39, "space", PRESSED, ' ' },
-	{ 0x3a, "CapsLock", PRESSED, 0x0 },
-	{ 0x3b, "F1", PRESSED, 0x0 },
-	{ 0x3c, "F2", PRESSED, 0x0 },
-	{ 0x3d, "F3", PRESSED, 0x0 },
-	{ 0x3e, "F4", PRESSED, 0x0 },
-	{ 0x3f, "F5", PRESSED, 0x0 },
-	{ 0x40, "F6", PRESSED, 0x0 },
-	{ 0x41, "F7", PRESSED, 0x0 },
-	{ 0x42, "F8", PRESSED, 0x0 },
-	{ 0x43, "F9", PRESSED, 0x0 },
-	{ 0x44, "F10", PRESSED, 0x0 },
-	{ 0x45, "NumberLock", PRESSED, 0x0 },
-	{ 0x46, "ScrollLock", PRESSED, 0x0 },
-	{ 0x47, "(keypad) 7", PRESSED, '7' },
-	{ 0x48, "(keypad) 8", PRESSED, '8' },
-	{ 0x49, "(keypad) 9", PRESSED, '9' },
-	{ 0x4a, "(keypad) -", PRESSED, '-' },
-	{ 0x4b, "(keypad) 4", PRESSED, '4' },
-	{ 0x4c, "(keypad) 5", PRESSED, '5' },
-	{ 0x4d, "(keypad) 6", PRESSED, '6' },
-	{ 0x4e, "(keypad) +", PRESSED, '+' },
-	{ 0x4f, "(keypad) 1", PRESSED, '1' },
-	{ 0x50, "(keypad) 2", PRESSED, '2' },
-	{ 0x51, "(keypad) 3", PRESSED, '3' },
-	{ 0x52, "(keypad) 0", PRESSED, '0' },
-	{ 0x53, "(keypad) .", PRESSED, '.' },
-	{ 0x57, "F11", PRESSED, 0x0 },
-	{ 0x58, "F12", PRESSED, 0x0 },
-	{ 0x81, "escape", RELEASED, 0x0 },
-	{ 0x82, "1", RELEASED, '1' },
-	{ 0x83, "2", RELEASED, '2' },
-	{ 0x84, "3", RELEASED, '3' },
-	{ 0x85, "4", RELEASED, '4' },
-	{ 0x86, "5", RELEASED, '5' },
-	{ 0x87, "6", RELEASED, '6' },
-	{ 0x88, "7", RELEASED, '7' },
-	{ 0x89, "8", RELEASED, '8' },
-	{ 0x8a, "9", RELEASED, '9' },
-	{ 0x8b, "0 (zero)", RELEASED, '0' },
-	{ 0x8c, "-", RELEASED, '-' },
-	{ 0x8d, "=", RELEASED, '=' },
-	{ 0x8e, "backspace", RELEASED, 0x0 },
-	{ 0x8f, "tab", RELEASED, '\t' },
-	{ 0x90, "Q", RELEASED, 'q' },
-	{ 0x91, "W", RELEASED, 'w' },
-	{ 0x92, "E", RELEASED, 'e' },
-	{ 0x93, "R", RELEASED, 'r' },
-	{ 0x94, "T", RELEASED, 't' },
-	{ 0x95, "Y", RELEASED, 'y' },
-	{ 0x96, "U", RELEASED, 'u' },
-	{ 0x97, "I", RELEASED, 'i' },
-	{ 0x98, "O", RELEASED, 'o' },
-	{ 0x99, "P", RELEASED, 'p' },
-	{ 0x9a, "[", RELEASED, '[' },
-	{ 0x9b, "]", RELEASED, ']' },
-	{ 0x9c, "enter", RELEASED, '\n' },
-	{ 0x9d, "left control", RELEASED, 0x0 },
-	{ 0x9e, "A", RELEASED, 'a' },
-	{ 0x9f, "S", RELEASED, 's' },
-	{ 0xa0, "D", RELEASED, 'd' },
-	{ 0xa1, "F", RELEASED, 'f' },
-	{ 0xa2, "G", RELEASED, 'g' },
-	{ 0xa3, "H", RELEASED, 'h' },
-	{ 0xa4, "J", RELEASED, 'j' },
-	{ 0xa5, "K", RELEASED, 'k' },
-	{ 0xa6, "L", RELEASED, 'l' },
-	{ 0xa7, ";", RELEASED, ';' },
-	{ 0xa8, "' (single quote)", RELEASED, '\'' },
-	{ 0xa9, "` (back tick)", RELEASED, '`' },
-	{ 0xaa, "left shift", RELEASED, 0x0 },
-	{ 0xab, "\\", RELEASED, '\\' },
-	{ 0xac, "Z", RELEASED, 'z' },
-	{ 0xad, "X", RELEASED, 'x' },
-	{ 0xae, "C", RELEASED, 'c' },
-	{ 0xaf, "V", RELEASED, 'v' },
-	{ 0xb0, "B", RELEASED, 'b' },
-	{ 0xb1, "N", RELEASED, 'n' },
-	{ 0xb2, "M", RELEASED, 'm' },
-	{ 0xb3, ",", RELEASED, ',' },
-	{ 0xb4, ".", RELEASED, '.' },
-	{ 0xb5, "/", RELEASED, '/' },
-	{ 0xb6, "right shift", RELEASED, 0x0 },
-	{ 0xb7, "(keypad) *", RELEASED, '*' },
-	{ 0xb8, "left alt", RELEASED, 0x0 },
-	{ 0xb9, "space", RELEASED, ' ' },
-	{ 0xba, "CapsLock", RELEASED, 0x0 },
-	{ 0xbb, "F1", RELEASED, 0x0 },
-	{ 0xbc, "F2", RELEASED, 0x0 },
-	{ 0xbd, "F3", RELEASED, 0x0 },
-	{ 0xbe, "F4", RELEASED, 0x0 },
-	{ 0xbf, "F5", RELEASED, 0x0 },
-	{ 0xc0, "F6", RELEASED, 0x0 },
-	{ 0xc1, "F7", RELEASED, 0x0 },
-	{ 0xc2, "F8", RELEASED, 0x0 },
-	{ 0xc3, "F9", RELEASED, 0x0 },
-	{ 0xc4, "F10", RELEASED, 0x0 },
-	{ 0xc5, "NumberLock", RELEASED, 0x0 },
-	{ 0xc6, "ScrollLock", RELEASED, 0x0 },
-	{ 0xc7, "(keypad) 7", RELEASED, '7' },
-	{ 0xc8, "(keypad) 8", RELEASED, '8' },
-	{ 0xc9, "(keypad) 9", RELEASED, '9' },
-	{ 0xca, "(keypad) -", RELEASED, '-' },
-	{ 0xcb, "(keypad) 4", RELEASED, '4' },
-	{ 0xcc, "(keypad) 5", RELEASED, '5' },
-	{ 0xcd, "(keypad) 6", RELEASED, '6' },
-	{ 0xce, "(keypad) +", RELEASED, '+' },
-	{ 0xcf, "(keypad) 1", RELEASED, '1' },
-	{ 0xd0, "(keypad) 2", RELEASED, '2' },
-	{ 0xd1, "(keypad) 3", RELEASED, '3' },
-	{ 0xd2, "(keypad) 0", RELEASED, '0' },
-	{ 0xd3, "(keypad) .", RELEASED, '.' },
-	{ 0xd7, "F11", RELEASED, 0x0 },
-	{ 0xd8, "F12", RELEASED, 0x0 },
-	{ 0xe010, "(multimedia) previous track", PRESSED, 0x0 },
-	{ 0xe019, "(multimedia) next track", PRESSED, 0x0 },
-	{ 0xe01c, "(keypad) enter", PRESSED, '\n' },
-	{ 0xe01d, "right control", PRESSED, 0x0 },
-	{ 0xe020, "(multimedia) mute", PRESSED, 0x0 },
-	{ 0xe021, "(multimedia) calculator", PRESSED, 0x0 },
-	{ 0xe022, "(multimedia) play", PRESSED, 0x0 },
-	{ 0xe024, "(multimedia) stop", PRESSED, 0x0 },
-	{ 0xe02e, "(multimedia) volume down", PRESSED, 0x0 },
-	{ 0xe030, "(multimedia) volume up", PRESSED, 0x0 },
-	{ 0xe032, "(multimedia) WWW home", PRESSED, 0x0 },
-	{ 0xe035, "(keypad) /", PRESSED, '/' },
-	{ 0xe038, "right alt (or altGr)", PRESSED, 0x0 },
-	{ 0xe047, "home", PRESSED, 0x0 },
-	{ 0xe048, "cursor up", PRESSED, 0x0 },
-	{ 0xe049, "page up", PRESSED, 0x0 },
-	{ 0xe04b, "cursor left", PRESSED, 0x0 },
-	{ 0xe04d, "cursor right", PRESSED, 0x0 },
-	{ 0xe04f, "end", PRESSED, 0x0 },
-	{ 0xe050, "cursor down", PRESSED, 0x0 },
-	{ 0xe051, "page down", PRESSED, 0x0 },
-	{ 0xe052, "insert", PRESSED, 0x0 },
-	{ 0xe053, "delete", PRESSED, 0x0 },
-	{ 0xe05b, "left GUI", PRESSED, 0x0 },
-	{ 0xe05c, "right GUI", PRESSED, 0x0 },
-	{ 0xe05d, "\"apps\"", PRESSED, 0x0 },
-	{ 0xe05e, "(ACPI) power", PRESSED, 0x0 },
-	{ 0xe05f, "(ACPI) sleep", PRESSED, 0x0 },
-	{ 0xe063, "(ACPI) wake", PRESSED, 0x0 },
-	{ 0xe065, "(multimedia) WWW search", PRESSED, 0x0 },
-	{ 0xe066, "(multimedia) WWW favorites", PRESSED, 0x0 },
-	{ 0xe067, "(multimedia) WWW refresh", PRESSED, 0x0 },
-	{ 0xe068, "(multimedia) WWW stop", PRESSED, 0x0 },
-	{ 0xe069, "(multimedia) WWW forward", PRESSED, 0x0 },
-	{ 0xe06a, "(multimedia) WWW back", PRESSED, 0x0 },
-	{ 0xe06b, "(multimedia) my computer", PRESSED, 0x0 },
-	{ 0xe06c, "(multimedia) email", PRESSED, 0x0 },
-	{ 0xe06d, "(multimedia) media select", PRESSED, 0x0 },
-	{ 0xe090, "(multimedia) previous track", RELEASED, 0x0 },
-	{ 0xe099, "(multimedia) next track", RELEASED, 0x0 },
-	{ 0xe09c, "(keypad) enter", RELEASED, '\n' },
-	{ 0xe09d, "right control", RELEASED, 0x0 },
-	{ 0xe0a0, "(multimedia) mute", RELEASED, 0x0 },
-	{ 0xe0a1, "(multimedia) calculator", RELEASED, 0x0 },
-	{ 0xe0a2, "(multimedia) play", RELEASED, 0x0 },
-	{ 0xe0a4, "(multimedia) stop", RELEASED, 0x0 },
-	{ 0xe0ae, "(multimedia) volume down", RELEASED, 0x0 },
-	{ 0xe0b0, "(multimedia) volume up", RELEASED, 0x0 },
-	{ 0xe0b2, "(multimedia) WWW home", RELEASED, 0x0 },
-	{ 0xe0b5, "(keypad) /", RELEASED, '/' },
-	{ 0xe0b8, "right alt (or altGr)", RELEASED, 0x0 },
-	{ 0xe0c7, "home", RELEASED, 0x0 },
-	{ 0xe0c8, "cursor up", RELEASED, 0x0 },
-	{ 0xe0c9, "page up", RELEASED, 0x0 },
-	{ 0xe0cb, "cursor left", RELEASED, 0x0 },
-	{ 0xe0cd, "cursor right", RELEASED, 0x0 },
-	{ 0xe0cf, "end", RELEASED, 0x0 },
-	{ 0xe0d0, "cursor down", RELEASED, 0x0 },
-	{ 0xe0d1, "page down", RELEASED, 0x0 },
-	{ 0xe0d2, "insert", RELEASED, 0x0 },
-	{ 0xe0d3, "delete", RELEASED, 0x0 },
-	{ 0xe0db, "left GUI", RELEASED, 0x0 },
-	{ 0xe0dc, "right GUI", RELEASED, 0x0 },
-	{ 0xe0dd, "\"apps\"", RELEASED, 0x0 },
-	{ 0xe0de, "(ACPI) power", RELEASED, 0x0 },
-	{ 0xe0df, "(ACPI) sleep", RELEASED, 0x0 },
-	{ 0xe0e3, "(ACPI) wake", RELEASED, 0x0 },
-	{ 0xe0e5, "(multimedia) WWW search", RELEASED, 0x0 },
-	{ 0xe0e6, "(multimedia) WWW favorites", RELEASED, 0x0 },
-	{ 0xe0e7, "(multimedia) WWW refresh", RELEASED, 0x0 },
-	{ 0xe0e8, "(multimedia) WWW stop", RELEASED, 0x0 },
-	{ 0xe0e9, "(multimedia) WWW forward", RELEASED, 0x0 },
-	{ 0xe0ea, "(multimedia) WWW back", RELEASED, 0x0 },
-	{ 0xe0eb, "(multimedia) my computer", RELEASED, 0x0 },
-	{ 0xe0ec, "(multimedia) email", RELEASED, 0x0 },
-	{ 0xe0ed, "(multimedia) media select", RELEASED, 0x0 },
-	{ 0xe02ae037, "print screen", PRESSED, 0x0 },
-	{ 0xe0b7e0aa, "print screen", RELEASED, 0x0 },
-	{ 0xe11d45e19dc5, "pause", PRESSED, 0x0 },
+	.read_iter = &driver_read_iter,
+	.unlocked_ioctl = &driver_ioctl,
+	// Every argument is a pointer, but the read mode whose values are the same once converted
+	.compat_ioctl = &compat_ptr_ioctl,
+	.mmap = &driver_mmap,
+	.poll = &driver_poll,
+	// Readers only move forward, through their cursor
+	.llseek = &noop_llseek,
 };
 
 static struct ps2_keyboard_state	keyboard_state = {
-	.scan_code_set = scan_code_set_2,
-	.set_len = sizeof(scan_code_set_2) / sizeof(*scan_code_set_2),
+	.scan_code_set = &scan_code_set_1,
 };
 
-static irqreturn_t	keyboard_irq_handler(int irq, void *dev_id)
+/*
+  Wall clock date of a record timestamp, in ns since the epoch
+ */
+static u64	driver_realtime(u64 timestamp)
 {
-	uint8_t					code;
-	struct scan_key_code			*key_id;
-
-	mb();
-	code = inb(KEYBOARD_IOPORT);
+	return timestamp - driver_data.clock.monotonic + driver_data.clock.realtime;
+}
 
-	if (!ps2_maybe_in_scan_set(&keyboard_state, code)) {
-		ps2_add_to_pending_code(&keyboard_state, code);
-		printk(KERN_WARNING LOG "Dropping code: %llx, as it may not belong to the scan set table in use\n", keyboard_state.pending_code);
-		ps2_reset_pending_code(&keyboard_state);
-		return IRQ_NONE;
+/*
+  Releases the entries every reader, and the log, is done with.
+  Nothing is reclaimed while there is no reader nor log.
+ */
+static void	driver_reclaim(void)
+{
+	struct driver_reader	*reader;
+	uint64_t		seq = U64_MAX;
+
+	if (key_entry_log_enabled(&driver_data.log))
+		seq = key_entry_log_cursor(&driver_data.log);
+	spin_lock(&driver_data.readers_lock);
+	if (list_empty(&driver_data.readers) && !key_entry_log_enabled(&driver_data.log)) {
+		spin_unlock(&driver_data.readers_lock);
+		return;
 	}
+	list_for_each_entry(reader, &driver_data.readers, node)
+		seq = min_t(uint64_t, seq, READ_ONCE(reader->cursor.seq));
+	spin_unlock(&driver_data.readers_lock);
+	key_entry_ring_reclaim(&driver_data.ring, seq);
+}
 
-	WARN_ON(!ps2_add_to_pending_code(&keyboard_state, code));
-	key_id = ps2_find_scan_key_code(&keyboard_state);
+/*
+  Pushes a key entry produced by the byte of the interrupt at `irq`
+ */
+static void	driver_push_record(const struct keyboard_driver_record *record, u64 irq)
+{
+	uint64_t    seq;
+
+	if (key_entry_ring_full(&driver_data.ring))
+		driver_reclaim();
+	seq = key_entry_ring_head(&driver_data.ring);
+	trace_keyboard_driver_key(seq, record);
+	if (!key_entry_ring_push(&driver_data.ring, record)) {
+		// Not much to do if the readers lag behind. just pop up a warning
+		printk_ratelimited(KERN_WARNING LOG "Key entry ring is full, %llu entries were dropped so far\n",
+				driver_data.ring.dropped);
+	} else {
+		key_entry_latency_enqueued(&driver_data.latency, seq, irq);
+	}
+}
 
-	if (key_id == NULL) {
-		printk(KERN_INFO LOG "Current buffered code: %#02llx\n", keyboard_state.pending_code);
+/*
+  Decodes a byte read by the interrupt handler, returns true if a key entry was produced
+ */
+static bool	keyboard_decode(struct raw_code *raw)
+{
+	const struct scan_key_code		*key_id = NULL;
+	enum ps2_decode_status			status;
+
+	status = ps2_decode_byte(&keyboard_state, raw->code);
+	if (status == PS2_DECODE_PENDING)
+		return false;
+	if (status == PS2_DECODE_COMPLETE)
+		key_id = ps2_find_scan_key_code(&keyboard_state);
+	// The automaton only accepts the codes of the set, a complete code is always found
+	if (status == PS2_DECODE_INVALID || WARN_ON_ONCE(key_id == NULL)) {
+		trace_ps2_drop(&keyboard_state);
+		this_cpu_inc(driver_counters.unknown_codes);
+		this_cpu_add(driver_counters.dropped_bytes, keyboard_state.current_code_index);
+		printk_ratelimited(KERN_WARNING LOG "Dropping code: %llx, as it may not belong to the scan set table in use\n",
+				   keyboard_state.pending_code);
+		ps2_reset_pending_code(&keyboard_state);
+		return false;
 	} else {
-		struct timeval	    now;
+		u64		    now;
 		long long	    hours;
 		long long	    minutes;
 		long long	    seconds;
-		struct key_entry    *entry;
+		struct keyboard_driver_record	record;
+		struct keyboard_driver_record	run;
+		bool		    repeat;
 		char		    c;
 
-		if (NULL == (entry = kmalloc(sizeof(struct key_entry), GFP_ATOMIC))) {
-			// Not much to do if kmalloc fails. just pop up a warning
-			printk(KERN_WARNING LOG "Failed to allocated for key_entry, entry log will be lost\n");
-			ps2_reset_pending_code(&keyboard_state);
-			goto out;
-		}
-		do_gettimeofday(&now);
+		this_cpu_inc(driver_counters.events);
+		ps2_fill_record(&keyboard_state, key_id, &record);
+		record.timestamp = raw->irq;
+		c = record.ascii_value;
+		ps2_reset_pending_code(&keyboard_state);
 
-		entry->date = now;
-		entry->key_id = key_id;
+		if (coalesce_repeats) {
+			repeat = ps2_coalesce_repeat(&keyboard_state, &record, &run);
+			// The run of repeats this event ends, or cuts at U16_MAX repeats
+			if (run.repeats != 0)
+				driver_push_record(&run, raw->irq);
+			if (repeat) {
+				this_cpu_inc(driver_counters.coalesced);
+				return run.repeats != 0;
+			}
+		}
+		driver_push_record(&record, raw->irq);
 
-		spin_lock(&key_list_spinlock);
-		list_add_tail(&entry->head, &key_entry_list);
-		spin_unlock(&key_list_spinlock);
+		if (!static_branch_unlikely(&driver_debug))
+			return true;
 
-		hours = (now.tv_sec / 3600) % 24;
-		now.tv_sec %= 3600;
-		minutes = now.tv_sec / 60;
-		now.tv_sec %= 60;
-		seconds = now.tv_sec;
+		now = driver_realtime(record.timestamp) / NSEC_PER_SEC;
+		hours = (now / 3600) % 24;
+		minutes = (now / 60) % 60;
+		seconds = now % 60;
 
-		c = ps2_key_name_with_modifiers(&keyboard_state, key_id);
 		if (c) {
 			printk(KERN_INFO LOG "%02lld:%02lld:%02lld %c(%#02llx) %s\n",
 				hours,
 				minutes,
 				seconds,
 				c,
-				key_id->code,
-				ps2_key_state_to_string(key_id->state));
+				record.code,
+				ps2_key_state_to_string(record.state));
 		} else {
 			printk(KERN_INFO LOG "%02lld:%02lld:%02lld %s(%#02llx) %s\n",
 				hours,
 				minutes,
 				seconds,
 				key_id->key_name,
-				key_id->code,
-				ps2_key_state_to_string(key_id->state));
+				record.code,
+				ps2_key_state_to_string(record.state));
 		}
-		ps2_reset_pending_code(&keyboard_state);
-		wake_up_interruptible(&read_wqueue);
+		return true;
+	}
+}
+
+static enum hrtimer_restart	driver_reader_deadline(struct hrtimer *timer)
+{
+	struct driver_reader	*reader = container_of(timer, struct driver_reader, deadline_timer);
+
+	wake_up_interruptible(&reader->wqueue);
+	return HRTIMER_NORESTART;
+}
+
+/*
+  Whether the reader should be woken up for the entries from `seq`.
+  The delay of a pending entry starts once it is first checked for, which is as the interrupt thread
+  produces it, or as the reader waits again for the entries its last read left.
+ */
+static bool	driver_reader_ready(struct driver_reader *reader, uint64_t seq)
+{
+	uint64_t    available = key_entry_ring_available(&driver_data.ring, seq);
+	bool	    ready;
+
+	if (available == 0)
+		return false;
+	if (available >= READ_ONCE(reader->wakeup_batch))
+		return true;
+	if (READ_ONCE(reader->wakeup_delay) == 0)
+		return false;
+	spin_lock(&reader->deadline_lock);
+	if (reader->deadline_seq != seq) {
+		reader->deadline_seq = seq;
+		reader->deadline = ktime_add_ns(ktime_get(), reader->wakeup_delay);
+		hrtimer_start(&reader->deadline_timer, reader->deadline, HRTIMER_MODE_ABS);
+		ready = false;
+	} else {
+		ready = ktime_compare(ktime_get(), reader->deadline) >= 0;
+	}
+	spin_unlock(&reader->deadline_lock);
+	return ready;
+}
+
+/*
+  Producer side, wakes up the readers which are ready for the entries after their cursor,
+  the others are left asleep until their batch is complete or their deadline expires.
+ */
+static void	driver_wake_readers(void)
+{
+	struct driver_reader	*reader;
+
+	spin_lock(&driver_data.readers_lock);
+	list_for_each_entry(reader, &driver_data.readers, node) {
+		if (wq_has_sleeper(&reader->wqueue) && driver_reader_ready(reader, READ_ONCE(reader->cursor.seq)))
+			wake_up_interruptible(&reader->wqueue);
 	}
-out:
-	return IRQ_NONE;
+	spin_unlock(&driver_data.readers_lock);
+}
+
+/*
+  Top half, only reads and timestamps the byte, everything else is deferred to keyboard_irq_thread().
+  The line is shared, the interrupt is not ours unless the controller holds a byte of the keyboard,
+  those of the aux port being left to the device they belong to.
+ */
+static irqreturn_t	keyboard_irq_handler(int irq, void *dev_id)
+{
+	struct raw_code	    raw;
+	uint8_t		    status;
+
+	mb();
+	status = inb(KEYBOARD_STATUS_IOPORT);
+	if ((status & (KEYBOARD_STATUS_OBF | KEYBOARD_STATUS_AUXDATA)) != KEYBOARD_STATUS_OBF)
+		return IRQ_NONE;
+	raw.code = inb(KEYBOARD_IOPORT);
+	// NMI safe and lockless, unlike ktime_get_ns()
+	raw.irq = ktime_get_mono_fast_ns();
+
+	this_cpu_inc(driver_counters.bytes_received);
+	if (!kfifo_put(&raw_codes, raw))
+		this_cpu_inc(driver_counters.overflows);
+	return IRQ_WAKE_THREAD;
+}
+
+/*
+  Bottom half, decodes every byte queued since it last ran, then wakes up the readers ready for them
+ */
+static irqreturn_t	keyboard_irq_thread(int irq, void *dev_id)
+{
+	struct raw_code	    raw;
+	bool		    produced = false;
+
+	while (kfifo_get(&raw_codes, &raw))
+		produced |= keyboard_decode(&raw);
+	if (produced) {
+		driver_wake_readers();
+		key_entry_log_kick(&driver_data.log);
+	}
+	return IRQ_HANDLED;
 }
 
 static int  driver_register_irq(void *dev_id)
 {
 	WARN_ON(irq == 0);
-	if (0 < request_irq(irq, &keyboard_irq_handler, IRQF_SHARED, MODULE_NAME, dev_id)) {
+	if (request_threaded_irq(irq, &keyboard_irq_handler, &keyboard_irq_thread, IRQF_SHARED, MODULE_NAME, dev_id)) {
 		printk(KERN_INFO LOG "Failed to request IRQ: %x\n", irq);
 		return -EBUSY;
 	}
@@ -684,110 +528,420 @@ static int  driver_register_irq(void *dev_id)
 	return 0;
 }
 
+/*
+  Waits until the reader is to be woken up for the entries from `seq`, O_NONBLOCK readers take whatever is available.
+ */
+static int	driver_reader_wait(struct file *file, struct driver_reader *reader, uint64_t seq)
+{
+	// Only a reader which slept was woken up, and times the stages from its wakeup
+	reader->woken = 0;
+	if (file->f_flags & O_NONBLOCK)
+		return key_entry_ring_peek(&driver_data.ring, seq) == NULL ? -EAGAIN : 0;
+	if (driver_reader_ready(reader, seq))
+		return 0;
+	if (wait_event_interruptible(reader->wqueue, driver_reader_ready(reader, seq)))
+		return -ERESTARTSYS;
+	this_cpu_inc(driver_counters.wakeups);
+	reader->woken = key_entry_latency_woken(&driver_data.latency, seq);
+	reader->woken_seq = seq;
+	return 0;
+}
+
+/*
+  read() is about to return the entries the reader was woken up for
+ */
+static void	driver_reader_copied(struct driver_reader *reader)
+{
+	u64	now;
+	u64	irq;
+
+	if (reader->woken == 0)
+		return;
+	now = ktime_get_ns();
+	irq = key_entry_latency_irq(&driver_data.latency, reader->woken_seq);
+	key_entry_latency_record(&driver_data.latency, KEY_ENTRY_LATENCY_WAKEUP_TO_COPY, now - reader->woken);
+	if (irq != 0 && irq < now)
+		key_entry_latency_record(&driver_data.latency, KEY_ENTRY_LATENCY_IRQ_TO_COPY, now - irq);
+	reader->woken = 0;
+}
+
+static int	driver_reader_set_wakeup(struct driver_reader *reader, uint32_t batch, uint32_t delay_us)
+{
+	if (batch == 0 || batch > driver_data.ring.limit)
+		return -EINVAL;
+	spin_lock(&reader->deadline_lock);
+	WRITE_ONCE(reader->wakeup_batch, batch);
+	WRITE_ONCE(reader->wakeup_delay, (u64)delay_us * NSEC_PER_USEC);
+	// Restarts the delay of the pending entry, if any
+	reader->deadline_seq = U64_MAX;
+	spin_unlock(&reader->deadline_lock);
+	return 0;
+}
+
 static int  driver_open(struct inode *inode, struct file *file)
 {
-	/* struct list_head *list = &key_entry_list; */
-	int		  ret;
+	struct driver_reader	*reader;
 
-	mutex_lock(&open_mutex);
 	printk(KERN_INFO LOG "%s has opened the device\n", current->comm);
 
-	file->private_data = NULL; //needed so that seq_open won't WARN_ON
-	ret = seq_open(file, &seq_ops);
-	if (ret) {
-		printk(KERN_WARNING LOG "seq_open() failed\n");
-		return ret;
+	reader = kzalloc(sizeof(*reader), GFP_KERNEL);
+	if (reader == NULL) {
+		this_cpu_inc(driver_counters.alloc_failures);
+		printk(KERN_WARNING LOG "Failed to allocate a reader\n");
+		return -ENOMEM;
 	}
+	mutex_init(&reader->lock);
+	// Every reader starts at the oldest entry of the ring
+	reader->cursor.seq = key_entry_ring_oldest(&driver_data.ring);
+	reader->cursor.lost = 0;
+	key_entry_text_init(&reader->text, driver_data.clock.realtime - driver_data.clock.monotonic);
+	reader->mode = KEYBOARD_DRIVER_TEXT_MODE;
+	reader->started = false;
+	init_waitqueue_head(&reader->wqueue);
+	spin_lock_init(&reader->deadline_lock);
+	hrtimer_setup(&reader->deadline_timer, &driver_reader_deadline, CLOCK_MONOTONIC, HRTIMER_MODE_ABS);
+	reader->woken = 0;
+	if (driver_reader_set_wakeup(reader, wakeup_batch, wakeup_delay_us))
+		driver_reader_set_wakeup(reader, DRIVER_DEFAULT_WAKEUP_BATCH, wakeup_delay_us);
+	spin_lock(&driver_data.readers_lock);
+	list_add_tail(&reader->node, &driver_data.readers);
+	spin_unlock(&driver_data.readers_lock);
+	file->private_data = reader;
+	return 0;
+}
 
-	/* while (list_is_last(list, &key_entry_list)) { */
-
-	/* 	ret = wait_event_interruptible(read_wqueue, !list_is_last(list, &key_entry_list)); */
-	/* 	if (ret) */
-	/* 		return -ERESTARTSYS; */
-
-	/* } */
+static long	driver_ioctl(struct file *file, unsigned int cmd, unsigned long arg)
+{
+	struct driver_reader		*reader = file->private_data;
+	struct keyboard_driver_wakeup	wakeup;
+	struct keyboard_driver_filter	filter;
+	struct keyboard_driver_stats	stats;
+	__u64				seq;
+	int				ret;
+
+	switch (cmd) {
+	case KEYBOARD_DRIVER_IOC_SET_READ_MODE:
+		if (arg != KEYBOARD_DRIVER_TEXT_MODE && arg != KEYBOARD_DRIVER_BINARY_MODE)
+			return -EINVAL;
+		// Under the lock of the reads, which start the reader and follow its mode
+		mutex_lock(&reader->lock);
+		ret = reader->started ? -EBUSY : 0;
+		if (ret == 0)
+			reader->mode = arg;
+		mutex_unlock(&reader->lock);
+		return ret;
+	case KEYBOARD_DRIVER_IOC_SET_WAKEUP:
+		if (copy_from_user(&wakeup, (void __user *)arg, sizeof(wakeup)))
+			return -EFAULT;
+		return driver_reader_set_wakeup(reader, wakeup.batch, wakeup.delay_us);
+	case KEYBOARD_DRIVER_IOC_CONSUME:
+		if (get_user(seq, (__u64 __user *)arg))
+			return -EFAULT;
+		mutex_lock(&reader->lock);
+		ret = -EINVAL;
+		if (reader->mode == KEYBOARD_DRIVER_BINARY_MODE
+			&& (int64_t)(seq - key_entry_ring_head(&driver_data.ring)) <= 0) {
+			WRITE_ONCE(reader->cursor.seq, seq);
+			key_entry_ring_catch_up(&driver_data.ring, &reader->cursor);
+			ret = 0;
+		}
+		mutex_unlock(&reader->lock);
+		return ret;
+	case KEYBOARD_DRIVER_IOC_SET_FILTER:
+		if (arg == 0) {
+			mutex_lock(&reader->lock);
+			key_entry_filter_disable(&reader->filter);
+			mutex_unlock(&reader->lock);
+			return 0;
+		}
+		if (copy_from_user(&filter, (void __user *)arg, sizeof(filter)))
+			return -EFAULT;
+		mutex_lock(&reader->lock);
+		ret = key_entry_filter_compile(&reader->filter, &filter);
+		mutex_unlock(&reader->lock);
+		return ret;
+	case KEYBOARD_DRIVER_IOC_GET_CLOCK:
+		if (copy_to_user((void __user *)arg, &driver_data.clock, sizeof(driver_data.clock)))
+			return -EFAULT;
+		return 0;
+	case KEYBOARD_DRIVER_IOC_GET_STATS:
+		memset(&stats, 0, sizeof(stats));
+		stats.head = key_entry_ring_head(&driver_data.ring);
+		stats.tail = key_entry_ring_oldest(&driver_data.ring);
+		stats.limit = driver_data.ring.limit;
+		stats.evicted = READ_ONCE(driver_data.ring.evicted);
+		stats.dropped = READ_ONCE(driver_data.ring.dropped);
+		stats.lost = READ_ONCE(reader->cursor.lost);
+		if (copy_to_user((void __user *)arg, &stats, sizeof(stats)))
+			return -EFAULT;
+		return 0;
+	default:
+		return -ENOTTY;
+	}
+}
 
-	((struct seq_file *)file->private_data)->private = &key_entry_list;
-	return ret;
+/*
+  Binary mode read, copies as many whole records as fit in `to` straight from the ring.
+  The records which were evicted while they were copied are copied again from the oldest one left.
+ */
+static ssize_t	driver_read_records(struct file *file, struct driver_reader *reader, struct iov_iter *to)
+{
+	struct keyboard_driver_record	*records;
+	size_t				copied = 0;
+	size_t				count = iov_iter_count(to);
+	size_t				size;
+	uint64_t			n;
+	int				ret;
+
+	if (count < sizeof(*records))
+		return -EINVAL;
+	ret = driver_reader_wait(file, reader, reader->cursor.seq);
+	if (ret)
+		return ret;
+	key_entry_ring_catch_up(&driver_data.ring, &reader->cursor);
+	// At most twice, when the records wrap around the end of the ring
+	while (0 != (n = min_t(uint64_t, key_entry_ring_contiguous(&driver_data.ring, reader->cursor.seq),
+					(count - copied) / sizeof(*records)))) {
+		records = key_entry_ring_peek(&driver_data.ring, reader->cursor.seq);
+		size = n * sizeof(*records);
+		if (copy_to_iter(records, size, to) != size)
+			return copied ? copied : -EFAULT;
+		if (key_entry_ring_catch_up(&driver_data.ring, &reader->cursor) != 0) {
+			// Over the evicted records
+			iov_iter_revert(to, size);
+			continue;
+		}
+		copied += size;
+		WRITE_ONCE(reader->cursor.seq, reader->cursor.seq + n);
+	}
+	return copied;
 }
 
-static void *driver_seq_start(struct seq_file *seq_file, loff_t *pos)
+/*
+  Binary mode read through a filter, the records which pass it are staged in `buf` before they are copied.
+  The cursor goes back where it was if the copy fails, so that no record is lost.
+ */
+static ssize_t	driver_read_filtered_records(struct file *file, struct driver_reader *reader, struct iov_iter *to)
 {
-	struct list_head *list = seq_file->private;
-	int		 ret;
+	struct keyboard_driver_record	*records = (struct keyboard_driver_record *)reader->buf;
+	uint64_t			seq = reader->cursor.seq;
+	size_t				count;
+	size_t				n = 0;
+	int				ret;
+
+	count = min_t(size_t, iov_iter_count(to), DRIVER_READ_BUFFER_SIZE) / sizeof(*records);
+	if (count == 0)
+		return -EINVAL;
+	ret = driver_reader_wait(file, reader, reader->cursor.seq);
+	if (ret)
+		return ret;
+	while (n < count && key_entry_ring_read(&driver_data.ring, &reader->cursor, &records[n])) {
+		if (key_entry_filter_match(&reader->filter, &records[n]))
+			n++;
+		else
+			this_cpu_inc(driver_counters.filtered);
+	}
+	if (copy_to_iter(records, n * sizeof(*records), to) != n * sizeof(*records)) {
+		WRITE_ONCE(reader->cursor.seq, seq);
+		key_entry_ring_catch_up(&driver_data.ring, &reader->cursor);
+		return -EFAULT;
+	}
+	return n * sizeof(*records);
+}
 
+/*
+  Renders the entries from the cursor which pass the filter into `buf`, as many whole lines as fit
+ */
+static void	driver_render_text(struct driver_reader *reader)
+{
+	struct keyboard_driver_record	record;
+	size_t				len = 0;
+
+	while (len + KEY_ENTRY_TEXT_MAX_LINE <= DRIVER_READ_BUFFER_SIZE
+		&& key_entry_ring_read(&driver_data.ring, &reader->cursor, &record)) {
+		if (!key_entry_filter_match(&reader->filter, &record)) {
+			this_cpu_inc(driver_counters.filtered);
+			continue;
+		}
+		trace_keyboard_driver_show(reader->cursor.seq - 1, &record);
+		if (static_branch_unlikely(&driver_debug))
+			printk(KERN_INFO LOG "Showing key entry %llu to pid %d\n", reader->cursor.seq - 1, current->tgid);
+		len += key_entry_text_format(&reader->text, &record, reader->buf + len);
+	}
+	reader->text_len = len;
+	reader->text_off = 0;
+}
 
-	/* if (list == NULL) { */
-	/* 	list = key_entry_list.prev; */
-	/* } */
+/*
+  Text mode read, one `HH:MM:SS name(code) state` line per entry.
+  The lines are rendered by pages, which are copied to `to` as a whole. A line which does not fit
+  in `to` is left in `buf` for the next read, the entries it was rendered from being consumed already.
+ */
+static ssize_t	driver_read_text(struct file *file, struct driver_reader *reader, struct iov_iter *to)
+{
+	size_t	copied = 0;
+	size_t	size;
+	int	ret;
 
-	while (list_is_last(list, &key_entry_list)) {
-		ret = wait_event_interruptible(read_wqueue, !list_is_last(list, &key_entry_list));
+	if (reader->text_off == reader->text_len) {
+		ret = driver_reader_wait(file, reader, reader->cursor.seq);
 		if (ret)
-			return (void *)-ERESTARTSYS;
+			return ret;
 	}
-	list = seq_list_start(&key_entry_list, *pos);
-
-
-
-	//	unsigned long	flags;
-
-//	spin_lock_irqsave(&key_list_spinlock, flags);
-
-//	spin_lock_irqsave(&key_list_spinlock, flags);
-	return list;
+	while (iov_iter_count(to) != 0) {
+		if (reader->text_off == reader->text_len) {
+			driver_render_text(reader);
+			if (reader->text_len == 0)
+				break;
+		}
+		size = min_t(size_t, reader->text_len - reader->text_off, iov_iter_count(to));
+		size = copy_to_iter(reader->buf + reader->text_off, size, to);
+		if (size == 0)
+			return copied ? copied : -EFAULT;
+		reader->text_off += size;
+		copied += size;
+	}
+	return copied;
 }
 
-static void driver_seq_stop(struct seq_file *seq_file, void *v)
+static ssize_t	driver_read_iter(struct kiocb *iocb, struct iov_iter *to)
 {
-
+	struct file		*file = iocb->ki_filp;
+	struct driver_reader	*reader = file->private_data;
+	ssize_t			ret;
+
+	mutex_lock(&reader->lock);
+	reader->started = true;
+	if (reader->buf == NULL && (reader->mode == KEYBOARD_DRIVER_TEXT_MODE || reader->filter.enabled)) {
+		reader->buf = kmalloc(DRIVER_READ_BUFFER_SIZE, GFP_KERNEL);
+		if (reader->buf == NULL) {
+			this_cpu_inc(driver_counters.alloc_failures);
+			mutex_unlock(&reader->lock);
+			return -ENOMEM;
+		}
+	}
+	// Until an entry passes the filter, the skipped ones may be all the reader was woken up for
+	do {
+		if (reader->mode == KEYBOARD_DRIVER_TEXT_MODE)
+			ret = driver_read_text(file, reader, to);
+		else if (reader->filter.enabled)
+			ret = driver_read_filtered_records(file, reader, to);
+		else
+			ret = driver_read_records(file, reader, to);
+	} while (ret == 0 && reader->filter.enabled && iov_iter_count(to) != 0);
+	if (ret > 0) {
+		driver_reader_copied(reader);
+		iocb->ki_pos += ret;
+	}
+	mutex_unlock(&reader->lock);
+	return ret;
 }
 
-static void *driver_seq_next(struct seq_file *seq_file, void *v, loff_t *pos)
+static int	driver_mmap(struct file *file, struct vm_area_struct *vma)
 {
-	/* if (list_is_last(v, &key_entry_list)) */
-	/* 	return NULL; */
-	return seq_list_next(v, &key_entry_list, pos);
+	return key_entry_ring_mmap(&driver_data.ring, vma);
 }
 
-static int driver_seq_show(struct seq_file *seq_file, void *v)
+/*
+  Readable once the reader is to be woken up for the entries produced after its cursor,
+  be it moved by read() or by KEYBOARD_DRIVER_IOC_CONSUME.
+ */
+static __poll_t	driver_poll(struct file *file, poll_table *wait)
 {
-	struct list_head	*list = v;
-	struct key_entry        *key_entry;
-	struct scan_key_code	*key_code;
-	long long		hours;
-	long long		minutes;
-	long long		seconds;
-	unsigned long		flags;
-
-	printk(KERN_INFO LOG "In driver_seq_show(): %px\n", v);
-	if (list == NULL) {
-		return -ESRCH; //dunno about this;
-	}
-	spin_lock_irqsave(&key_list_spinlock, flags);
-	key_entry = list_entry(v, struct key_entry, head);
-	WARN_ON(key_entry == NULL);
-	hours = (key_entry->date.tv_sec / 3600) % 24;
-	minutes = (key_entry->date.tv_sec / 60) % 60;
-	seconds = (key_entry->date.tv_sec) % 60;
-
-	printk(KERN_INFO LOG "key_id : %px\n", key_entry->key_id);
-	key_code = key_entry->key_id; //secure this
-	spin_unlock_irqrestore(&key_list_spinlock, flags);
-	seq_printf(seq_file, "%02lld:%02lld:%02lld %s(%#02llx) %s\n", hours, minutes, seconds,
-		key_code->key_name,
-		key_code->code,
-		ps2_key_state_to_string(key_code->state));
+	struct driver_reader	*reader = file->private_data;
+
+	poll_wait(file, &reader->wqueue, wait);
+	// Text left from the last read
+	if (READ_ONCE(reader->text_off) != READ_ONCE(reader->text_len))
+		return EPOLLIN | EPOLLRDNORM;
+	if (driver_reader_ready(reader, READ_ONCE(reader->cursor.seq)))
+		return EPOLLIN | EPOLLRDNORM;
 	return 0;
 }
 
 static int  driver_release(struct inode *inode, struct file *file)
 {
+	struct driver_reader	*reader = file->private_data;
+
 	printk(KERN_INFO LOG "Release of " MODULE_NAME " file by pid: %d\n", current->tgid);
-	mutex_unlock(&open_mutex);
+	spin_lock(&driver_data.readers_lock);
+	list_del(&reader->node);
+	spin_unlock(&driver_data.readers_lock);
+	if (reader->cursor.lost != 0)
+		printk(KERN_INFO LOG "%llu key entries were evicted before pid %d could read them\n",
+			reader->cursor.lost, current->tgid);
+	hrtimer_cancel(&reader->deadline_timer);
+	kfree(reader->buf);
+	kfree(reader);
 	return 0;
 }
 
+/*
+  Sum over every CPU of the counter at `offset` in `struct driver_counters`
+ */
+static u64	driver_counter_sum(size_t offset)
+{
+	u64	sum = 0;
+	int	cpu;
+
+	for_each_possible_cpu(cpu)
+		sum += READ_ONCE(*(u64 *)((char *)per_cpu_ptr(&driver_counters, cpu) + offset));
+	return sum;
+}
+
+#define DRIVER_COUNTER_ATTR(name)					\
+	static ssize_t	name##_show(struct device *dev, struct device_attribute *attr, char *buf) \
+	{								\
+		return sprintf(buf, "%llu\n", driver_counter_sum(offsetof(struct driver_counters, name))); \
+	}								\
+	static DEVICE_ATTR_RO(name)
+
+// Key entries the retention limit dropped as they were pushed, or evicted before every reader got them
+#define DRIVER_RING_COUNTER_ATTR(name)					\
+	static ssize_t	name##_show(struct device *dev, struct device_attribute *attr, char *buf) \
+	{								\
+		return sprintf(buf, "%llu\n", (u64)READ_ONCE(driver_data.ring.name)); \
+	}								\
+	static DEVICE_ATTR_RO(name)
+
+DRIVER_COUNTER_ATTR(bytes_received);
+DRIVER_COUNTER_ATTR(events);
+DRIVER_COUNTER_ATTR(unknown_codes);
+DRIVER_COUNTER_ATTR(dropped_bytes);
+DRIVER_COUNTER_ATTR(alloc_failures);
+DRIVER_COUNTER_ATTR(overflows);
+DRIVER_COUNTER_ATTR(wakeups);
+DRIVER_COUNTER_ATTR(filtered);
+DRIVER_COUNTER_ATTR(coalesced);
+DRIVER_RING_COUNTER_ATTR(dropped);
+DRIVER_RING_COUNTER_ATTR(evicted);
+
+static struct attribute	*driver_counters_attrs[] = {
+	&dev_attr_bytes_received.attr,
+	&dev_attr_events.attr,
+	&dev_attr_unknown_codes.attr,
+	&dev_attr_dropped_bytes.attr,
+	&dev_attr_alloc_failures.attr,
+	&dev_attr_overflows.attr,
+	&dev_attr_wakeups.attr,
+	&dev_attr_filtered.attr,
+	&dev_attr_coalesced.attr,
+	&dev_attr_dropped.attr,
+	&dev_attr_evicted.attr,
+	NULL,
+};
+
+// In /sys/class/misc/keyboard_driver/counters/
+static const struct attribute_group	driver_counters_group = {
+	.name = "counters",
+	.attrs = driver_counters_attrs,
+};
+
+static const struct attribute_group	*driver_groups[] = {
+	&driver_counters_group,
+	NULL,
+};
+
 static void __initdata	handle_params(void)
 {
 	if (irq != 0) {
@@ -803,14 +957,110 @@ static void __initdata	handle_params(void)
 	}
 }
 
+static int __init	parse_scan_code_set(const struct scan_code_set **set)
+{
+	static const struct scan_code_set *const	sets[] = {
+		&scan_code_set_1,
+		&scan_code_set_2,
+		&scan_code_set_3,
+	};
+
+	if (scan_code_set == 0 || scan_code_set > ARRAY_SIZE(sets))
+		return -EINVAL;
+	*set = sets[scan_code_set - 1];
+	return 0;
+}
+
+static int __init	parse_log_fsync(enum key_entry_log_fsync *fsync)
+{
+	if (strcmp(log_fsync, "never") == 0)
+		*fsync = KEY_ENTRY_LOG_FSYNC_NEVER;
+	else if (strcmp(log_fsync, "close") == 0)
+		*fsync = KEY_ENTRY_LOG_FSYNC_CLOSE;
+	else if (strcmp(log_fsync, "flush") == 0)
+		*fsync = KEY_ENTRY_LOG_FSYNC_FLUSH;
+	else
+		return -EINVAL;
+	return 0;
+}
+
+/*
+  Number of entries retained according to the retain_* parameters, 0 if they are invalid
+ */
+static unsigned long __init	retention_limit(void)
+{
+	unsigned long	limit = ULONG_MAX;
+
+	if (retain_events != 0)
+		limit = min_t(unsigned long, limit, retain_events);
+	if (retain_bytes != 0)
+		limit = min_t(unsigned long, limit, retain_bytes / sizeof(struct keyboard_driver_record));
+	return limit;
+}
+
 static int __init	init(void)
 {
-	int		    ret;
+	enum key_entry_ring_policy	policy;
+	enum key_entry_log_fsync	fsync;
+	int				ret;
 
 	handle_params();
-	ret = driver_register_irq(&key_entry_list);
+	if (strcmp(drop_policy, "oldest") == 0) {
+		policy = KEY_ENTRY_RING_DROP_OLDEST;
+	} else if (strcmp(drop_policy, "newest") == 0) {
+		policy = KEY_ENTRY_RING_DROP_NEWEST;
+	} else {
+		printk(KERN_WARNING LOG "Invalid drop_policy: %s\n", drop_policy);
+		return -EINVAL;
+	}
+	if (parse_scan_code_set(&keyboard_state.scan_code_set)) {
+		printk(KERN_WARNING LOG "Invalid scan_code_set: %u\n", scan_code_set);
+		return -EINVAL;
+	}
+	if (parse_log_fsync(&fsync)) {
+		printk(KERN_WARNING LOG "Invalid log_fsync: %s\n", log_fsync);
+		return -EINVAL;
+	}
+	if (retention_limit() == 0) {
+		printk(KERN_WARNING LOG "retain_bytes is smaller than a key entry\n");
+		return -EINVAL;
+	}
+	INIT_LIST_HEAD(&driver_data.readers);
+	spin_lock_init(&driver_data.readers_lock);
+	driver_data.clock.monotonic = ktime_get_mono_fast_ns();
+	driver_data.clock.realtime = ktime_get_real_ns();
+	key_entry_text_setup();
+	ret = key_entry_ring_init(&driver_data.ring, ring_size, retention_limit(), policy);
+	if (ret) {
+		printk(KERN_WARNING LOG "Failed to allocate the key entry ring\n");
+		return ret;
+	}
+	if (log_file[0] != '\0') {
+		ret = key_entry_log_init(&driver_data.log, &driver_data.ring, log_file, log_batch, log_flush_ms, fsync,
+					 driver_data.clock.realtime - driver_data.clock.monotonic);
+		if (ret) {
+			if (ret == -ENOMEM)
+				this_cpu_inc(driver_counters.alloc_failures);
+			printk(KERN_WARNING LOG "Failed to open the log, key entries are not persisted\n");
+		}
+	}
+	driver_data.debugfs = debugfs_create_dir(MODULE_NAME, NULL);
+	if (key_entry_latency_init(&driver_data.latency, &driver_data.ring, driver_data.debugfs)) {
+		this_cpu_inc(driver_counters.alloc_failures);
+		printk(KERN_WARNING LOG "Failed to allocate the latency histograms, latencies are not recorded\n");
+	}
+#ifdef DEBUG
+	WARN_ON(!check_scan_code_index(keyboard_state.scan_code_set));
+	WARN_ON(!check_scan_code_automaton(keyboard_state.scan_code_set));
+#endif
+
+	ret = driver_register_irq(&driver_data);
 	if (ret) {
 		printk(KERN_WARNING LOG "Failed to register irq: %d\n", irq);
+		key_entry_latency_destroy(&driver_data.latency);
+		debugfs_remove_recursive(driver_data.debugfs);
+		key_entry_log_destroy(&driver_data.log);
+		key_entry_ring_destroy(&driver_data.ring);
 		return ret;
 	}
 	printk(KERN_INFO LOG "driver_register_irq() returned %d\n", ret);
@@ -822,40 +1072,39 @@ static int __init	init(void)
 	driver_data.device.this_device = NULL; //check this
 	driver_data.device.nodename = MODULE_NAME;
 	driver_data.device.minor = minor;
+	driver_data.device.groups = driver_groups;
 
 	ret = misc_register(&driver_data.device);
 
 	if (ret != 0) {
 		printk(KERN_WARNING LOG "Failed to register misc device\n");
-		goto out;
+		goto out_free_irq;
 	}
-out:
+	return 0;
+out_free_irq:
+	free_irq(irq, &driver_data);
+	key_entry_latency_destroy(&driver_data.latency);
+	debugfs_remove_recursive(driver_data.debugfs);
+	key_entry_log_destroy(&driver_data.log);
+	key_entry_ring_destroy(&driver_data.ring);
 	return ret;
 }
 module_init(init);
 
 static void __exit  cleanup(void)
 {
-	struct list_head *cur;
-	struct list_head *tmp;
-	struct key_entry *key_entry;
-
-
-	free_irq(irq, &key_entry_list);
+	free_irq(irq, &driver_data);
 	misc_deregister(&driver_data.device);
-
-	list_for_each_safe(cur, tmp, &key_entry_list) {
-		key_entry = list_entry(cur, struct key_entry, head);
-		WARN_ON(key_entry == NULL); //why the fuck I am doing this
-
-		if (key_code_has_ascii_value(key_entry->key_id)
-			&& key_entry->key_id->state == PRESSED) {
-			char c = ps2_key_name_with_modifiers(&keyboard_state, key_entry->key_id);
-			(void)c;
-		}
-		list_del(cur);
-		kfree(key_entry);
-	}
+	if (driver_counter_sum(offsetof(struct driver_counters, overflows)) != 0)
+		printk(KERN_INFO LOG "%llu bytes were lost as the interrupt thread lagged behind\n",
+			driver_counter_sum(offsetof(struct driver_counters, overflows)));
+	if (driver_data.ring.evicted != 0 || driver_data.ring.dropped != 0)
+		printk(KERN_INFO LOG "%llu key entries were evicted and %llu dropped as the retention limit was reached\n",
+			driver_data.ring.evicted, driver_data.ring.dropped);
+	key_entry_latency_destroy(&driver_data.latency);
+	debugfs_remove_recursive(driver_data.debugfs);
+	key_entry_log_destroy(&driver_data.log);
+	key_entry_ring_destroy(&driver_data.ring);
 	printk(KERN_INFO LOG "Cleanup up module\n");
 }
 module_exit(cleanup);
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: GPL-2.0
 #include "ps2_keyboard_state.h"
 #include "scan_code_sets.h"
+#include "keyboard_driver_trace.h"
 #include <linux/kernel.h>
 
 #define LOG __FILE__": "
@@ -10,14 +11,54 @@ inline bool	ps2_code_is_pending(struct ps2_keyboard_state *state)
 	return state->code_pending;
 }
 
+static uint16_t	ps2_next_transition(struct ps2_keyboard_state *state, uint8_t code)
+{
+	if (state->code_pending == false)
+		return state->scan_code_set->automaton->transitions[SCAN_CODE_AUTOMATON_ROOT][code];
+	// Nothing can follow a complete code
+	if (state->transition & SCAN_CODE_TRANSITION_ACCEPT)
+		return SCAN_CODE_TRANSITION_INVALID;
+	return state->scan_code_set->automaton->transitions[state->transition][code];
+}
+
+/*
+  Whether `code` is the break prefix of the set, where the pending code can take it: anywhere but after itself
+  or after a complete code. Long codes such as print screen hold it once per key they are made of.
+ */
+static bool	ps2_is_break_prefix(struct ps2_keyboard_state *state, uint8_t code)
+{
+	if (code != state->scan_code_set->break_prefix || code == 0)
+		return false;
+	if (!state->code_pending)
+		return true;
+	return !(state->break_pending && (state->pending_code & 0xFF) == code)
+		&& !(state->transition & SCAN_CODE_TRANSITION_ACCEPT);
+}
+
+/*
+  Returns false if the pending code would not be a prefix of any code of the set anymore,
+  `code` is still added to it so that it can be logged before being reset.
+  The break prefix leaves the automaton where it is, as the break code of a key is its make code with this prefix
+  before the last byte.
+ */
 inline bool	ps2_add_to_pending_code(struct ps2_keyboard_state *state, uint8_t code)
 {
+	uint16_t    transition;
+	bool	    valid;
+
 	if (state->current_code_index == 8U) {
 		printk(KERN_WARNING LOG "Failed to add byte to pending code as the compound code would exceed the maximum size\n");
 		printk(KERN_WARNING LOG "Current pending code is dropped\n");
 		ps2_reset_pending_code(state);
 		return false;
 	}
+	transition = ps2_next_transition(state, code);
+	valid = transition != SCAN_CODE_TRANSITION_INVALID;
+	if (!valid && ps2_is_break_prefix(state, code)) {
+		transition = state->code_pending ? state->transition : SCAN_CODE_AUTOMATON_ROOT;
+		state->break_pending = true;
+		valid = true;
+	}
 	if (state->code_pending == true) {
 		state->pending_code <<= 8U;
 		state->pending_code |= code;
@@ -27,7 +68,9 @@ inline bool	ps2_add_to_pending_code(struct ps2_keyboard_state *state, uint8_t co
 		state->pending_code = code;
 		state->current_code_index = 1;
 	}
-	return true;
+	state->transition = transition;
+	trace_ps2_byte(state, code);
+	return valid;
 }
 
 inline void	ps2_reset_pending_code(struct ps2_keyboard_state *state)
@@ -35,6 +78,8 @@ inline void	ps2_reset_pending_code(struct ps2_keyboard_state *state)
 	state->pending_code = 0;
 	state->code_pending = false;
 	state->current_code_index = 0;
+	state->transition = SCAN_CODE_AUTOMATON_ROOT;
+	state->break_pending = false;
 }
 
 inline void	ps2_reset_flags(struct ps2_keyboard_state *state)
@@ -44,151 +89,85 @@ inline void	ps2_reset_flags(struct ps2_keyboard_state *state)
 
 inline bool	ps2_maybe_in_scan_set(struct ps2_keyboard_state *state, uint8_t code)
 {
-	printk(KERN_INFO LOG "index: %d\n", state->current_code_index);
-	return maybe_in_scan_set(state->scan_code_set, state->set_len, code, state->current_code_index);
+	return ps2_next_transition(state, code) != SCAN_CODE_TRANSITION_INVALID
+		|| ps2_is_break_prefix(state, code);
 }
 
-static bool	escape_callback(struct ps2_keyboard_state *state, struct scan_key_code *key)
+/*
+  Feeds one byte of the device output to the decoder, with a single automaton transition.
+ */
+enum ps2_decode_status	ps2_decode_byte(struct ps2_keyboard_state *state, uint8_t code)
 {
-	if (key->state == PRESSED) {
-		state->flags |= PS2_ESCAPE_ACTIVE;
-	} else {
-		state->flags &= ~PS2_ESCAPE_ACTIVE;
-	}
-	return true;
+	if (!ps2_add_to_pending_code(state, code))
+		return PS2_DECODE_INVALID;
+	if (state->transition & SCAN_CODE_TRANSITION_ACCEPT)
+		return PS2_DECODE_COMPLETE;
+	return PS2_DECODE_PENDING;
 }
 
-static bool	left_control_callback(struct ps2_keyboard_state *state, struct scan_key_code *key)
-{
-	if (key->state == PRESSED) {
-		state->flags |= PS2_LEFT_CTRL_ACTIVE;
-	} else {
-		state->flags &= ~PS2_LEFT_CTRL_ACTIVE;
-	}
-	return true;
-}
+/*
+  How each modifier updates `ps2_keyboard_state.flags`, depending on the state of its key:
+  flags = (flags & ~clear) ^ toggle.
+  Held modifiers are set while their key is pressed, locks are toggled by each press.
+  A lock key stays in `locks_held` until its release, so that its typematic repeats do not toggle it.
+ */
+struct ps2_modifier_update {
+	uint16_t    clear;
+	uint16_t    toggle;
+	uint16_t    lock;
+};
 
-static bool	right_control_callback(struct ps2_keyboard_state *state, struct scan_key_code *key)
-{
-	if (key->state == PRESSED) {
-		state->flags |= PS2_RIGHT_CTRL_ACTIVE;
-	} else {
-		state->flags &= ~PS2_RIGHT_CTRL_ACTIVE;
-	}
-	return true;
+#define PS2_HELD_MODIFIER(flag) { [PRESSED] = { flag, flag, 0 }, [RELEASED] = { flag, 0, 0 } }
+#define PS2_LOCK_MODIFIER(flag) { [PRESSED] = { 0, flag, flag }, [RELEASED] = { 0, 0, flag } }
 
-}
-
-static bool	left_shift_callback(struct ps2_keyboard_state *state, struct scan_key_code *key)
-{
-	if (key->state == PRESSED) {
-		state->flags |= PS2_LEFT_SHIFT_ACTIVE;
-	} else {
-		state->flags &= ~PS2_LEFT_SHIFT_ACTIVE;
-	}
-	return true;
-}
+static const struct ps2_modifier_update	modifier_updates[PS2_MODIFIER_COUNT][2] = {
+	[PS2_MODIFIER_NONE] = { { 0, 0, 0 }, { 0, 0, 0 } },
+	[PS2_MODIFIER_ESCAPE] = PS2_HELD_MODIFIER(PS2_ESCAPE_ACTIVE),
+	[PS2_MODIFIER_LEFT_CONTROL] = PS2_HELD_MODIFIER(PS2_LEFT_CTRL_ACTIVE),
+	[PS2_MODIFIER_RIGHT_CONTROL] = PS2_HELD_MODIFIER(PS2_RIGHT_CTRL_ACTIVE),
+	[PS2_MODIFIER_LEFT_SHIFT] = PS2_HELD_MODIFIER(PS2_LEFT_SHIFT_ACTIVE),
+	[PS2_MODIFIER_RIGHT_SHIFT] = PS2_HELD_MODIFIER(PS2_RIGHT_SHIFT_ACTIVE),
+	[PS2_MODIFIER_CAPSLOCK] = PS2_LOCK_MODIFIER(PS2_CAPSLOCK_ACTIVE),
+	[PS2_MODIFIER_NUMBER_LOCK] = PS2_LOCK_MODIFIER(PS2_NUM_LOCK_ACTIVE),
+	[PS2_MODIFIER_SCROLL_LOCK] = PS2_LOCK_MODIFIER(PS2_SCROLL_LOCK_ACTIVE),
+	[PS2_MODIFIER_LEFT_ALT] = PS2_HELD_MODIFIER(PS2_LEFT_ALT_ACTIVE),
+	[PS2_MODIFIER_RIGHT_ALT] = PS2_HELD_MODIFIER(PS2_RIGHT_ALT_ACTIVE),
+};
 
-static bool	right_shift_callback(struct ps2_keyboard_state *state, struct scan_key_code *key)
+/*
+  State of `key` as completed by the pending code, released if it came with the break prefix
+ */
+inline enum ps2_key_state	ps2_key_state(const struct ps2_keyboard_state *state, const struct scan_key_code *key)
 {
-	if (key->state == PRESSED) {
-		state->flags |= PS2_RIGHT_SHIFT_ACTIVE;
-	} else {
-		state->flags &= ~PS2_RIGHT_SHIFT_ACTIVE;
-	}
-	return true;
+	return state->break_pending ? RELEASED : key->state;
 }
 
-static bool	capslock_callback(struct ps2_keyboard_state *state, struct scan_key_code *key)
+inline bool	ps2_catch_modifiers(struct ps2_keyboard_state *state, const struct scan_key_code *key)
 {
-	if (key->state == PRESSED) {
-		state->flags ^= PS2_CAPSLOCK_ACTIVE;
-	}
-	return true;
-}
+	const struct ps2_modifier_update    *update;
+	enum ps2_key_state		    key_state;
 
-static bool	number_lock_callback(struct ps2_keyboard_state *state, struct scan_key_code *key)
-{
-	if (key->state == PRESSED) {
-		state->flags ^= PS2_NUM_LOCK_ACTIVE;
-	}
-	return true;
-}
-
-static bool	scroll_lock_callback(struct ps2_keyboard_state *state, struct scan_key_code *key)
-{
-	if (key->state == PRESSED) {
-		state->flags ^= PS2_SCROLL_LOCK_ACTIVE;
-	}
-	return true;
-}
-
-static bool	left_alt_callback(struct ps2_keyboard_state *state, struct scan_key_code *key)
-{
-	if (key->state == PRESSED) {
-		state->flags |= PS2_LEFT_ALT_ACTIVE;
-	} else {
-		state->flags &= ~PS2_LEFT_ALT_ACTIVE;
-	}
-	return true;
-}
-
-static bool	right_alt_callback(struct ps2_keyboard_state *state, struct scan_key_code *key)
-{
-	if (key->state == PRESSED) {
-		state->flags |= PS2_RIGHT_ALT_ACTIVE;
-	} else {
-		state->flags &= ~PS2_RIGHT_ALT_ACTIVE;
-	}
+	if (key->modifier == PS2_MODIFIER_NONE)
+		return false;
+	key_state = ps2_key_state(state, key);
+	update = &modifier_updates[key->modifier][key_state];
+	state->flags = (state->flags & ~update->clear) ^ (update->toggle & ~state->locks_held);
+	if (key_state == PRESSED)
+		state->locks_held |= update->lock;
+	else
+		state->locks_held &= ~update->lock;
+	trace_ps2_modifier(state, key);
 	return true;
 }
 
-inline bool	ps2_catch_modifiers(struct ps2_keyboard_state *state, struct scan_key_code *key)
-{
-	static const char *const modifier_names[] = {
-		"escape",
-		"left control",
-		"right control",
-		"left shift",
-		"right shift",
-		"CapsLock",
-		"NumberLock",
-		"ScrollLock",
-		"left alt",
-		"right alt",
-	};
-	static const ps2_modifier_callback_t	callbacks[] = {
-		&escape_callback,
-		&left_control_callback,
-		&right_control_callback,
-		&left_shift_callback,
-		&right_shift_callback,
-		&capslock_callback,
-		&number_lock_callback,
-		&scroll_lock_callback,
-		&left_alt_callback,
-		&right_alt_callback,
-	};
-	uint32_t    i;
-
-	i = 0;
-	while (i < sizeof(callbacks) / sizeof(*callbacks)) {
-		if (!strcmp(key->key_name, modifier_names[i])) {
-			printk(KERN_INFO LOG "catch a keyboard modifier: %s\n", modifier_names[i]);
-			return callbacks[i](state, key);
-		}
-		i++;
-	}
-	return false;
-}
-
-struct scan_key_code *ps2_find_scan_key_code(struct ps2_keyboard_state *state)
+const struct scan_key_code *ps2_find_scan_key_code(struct ps2_keyboard_state *state)
 {
-	struct scan_key_code *key;
+	const struct scan_key_code *key;
 
-	if (state->code_pending == false)
+	if (state->code_pending == false
+		|| !(state->transition & SCAN_CODE_TRANSITION_ACCEPT))
 		return NULL;
-	key = find_scan_key_code(state->scan_code_set, state->set_len, state->pending_code);
+	key = &state->scan_code_set->keys[state->transition & ~SCAN_CODE_TRANSITION_ACCEPT];
 
 	if (key) {
 		ps2_catch_modifiers(state, key);
@@ -215,7 +194,7 @@ static int	    toupper(int c)
 	return c;
 }
 
-char		    ps2_key_name_with_modifiers(struct ps2_keyboard_state *state, struct scan_key_code *key_id)
+char		    ps2_key_name_with_modifiers(struct ps2_keyboard_state *state, const struct scan_key_code *key_id)
 {
 	const char  *has_shifted_value = "1234567890-=[]\\';/.,`";
 	const char  *shifted_values =    "!@#$%^&*()_+{}|\":?><~";
@@ -238,3 +217,54 @@ char		    ps2_key_name_with_modifiers(struct ps2_keyboard_state *state, struct s
 	}
 	return c;
 }
+
+/*
+  Fills `record` with the key event of `key_id`, once ps2_find_scan_key_code() applied it to the modifiers,
+  and before the pending code is reset. The code is the one received, break prefix included.
+  The timestamp is left to the caller.
+ */
+void		    ps2_fill_record(struct ps2_keyboard_state *state, const struct scan_key_code *key_id,
+				    struct keyboard_driver_record *record)
+{
+	record->code = state->code_pending ? state->pending_code : key_id->code;
+	record->modifiers = state->flags;
+	record->key_id = key_id->id;
+	record->state = ps2_key_state(state, key_id);
+	record->ascii_value = ps2_key_name_with_modifiers(state, key_id);
+	record->flags = 0;
+	record->repeats = 0;
+}
+
+/*
+  Typematic coalescing of the dated `record`, a repeat being the make code of the held key sent again.
+  Returns true if `record` is a repeat, to be dropped as it is counted in the current run.
+  Otherwise the current run ends, and if it had any repeat `run` is filled with its KEYBOARD_DRIVER_RECORD_REPEAT
+  record, to be emitted before `record`, in which case `run->repeats` is not 0.
+  A run which reaches U16_MAX repeats ends the same way before the repeat which starts the next one.
+ */
+bool		    ps2_coalesce_repeat(struct ps2_keyboard_state *state, const struct keyboard_driver_record *record,
+					struct keyboard_driver_record *run)
+{
+	bool	    repeat;
+
+	run->repeats = 0;
+	repeat = state->repeat_held && record->state == PRESSED && record->code == state->repeat.code;
+	if (state->repeat.repeats != 0 && (!repeat || state->repeat.repeats == U16_MAX)) {
+		*run = state->repeat;
+		run->flags |= KEYBOARD_DRIVER_RECORD_REPEAT;
+		state->repeat.repeats = 0;
+	}
+	if (repeat) {
+		state->repeat.timestamp = record->timestamp;
+		state->repeat.repeats++;
+		return true;
+	}
+	if (record->state == PRESSED) {
+		state->repeat = *record;
+		state->repeat_held = true;
+	} else if (record->key_id == state->repeat.key_id) {
+		// The break of the held key, the keyboard only repeats the last key pressed
+		state->repeat_held = false;
+	}
+	return false;
+}
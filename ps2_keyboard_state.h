@@ -3,6 +3,7 @@
 # define __PS2_KEYBOARD_STATE_H__
 
 # include "scan_code_sets.h"
+# include "keyboard_driver.h"
 
 
 # define PS2_CAPSLOCK_ACTIVE (1U << 15U)
@@ -18,12 +19,15 @@
 
 /*
   The whole point of this struct is to make us able to track the states of the keyboard in a elegant way.
-  Also making us able to emulate the keyboard behavior from a list of `key_entry`.
+  Also making us able to emulate the keyboard behavior from a list of `keyboard_driver_record`.
  */
 struct ps2_keyboard_state   {
 	// states such as capslock on, shifts on, and so on...
 	uint16_t		flags;
 
+	// Lock flags whose key is held, so that its typematic repeats do not toggle them again
+	uint16_t		locks_held;
+
 	// For compound codes, as the output buffer of the keyboard is one byte long, we did to collect parts of the key codes.
 	uint64_t	        pending_code;
 
@@ -33,28 +37,42 @@ struct ps2_keyboard_state   {
 	// Current number of bytes composing the compound `pending_code` - 1
 	uint8_t			current_code_index;
 
-	// Current scan_code_set used by the keyboard
-	struct scan_key_code	*scan_code_set;
+	// Current scan_code_set used by the keyboard, along with its lookup structures
+	const struct scan_code_set	*scan_code_set;
+
+	// Last transition taken in `scan_code_automaton` by `pending_code`
+	uint16_t		transition;
+
+	// Whether `pending_code` holds the break prefix of the set, making it the break code of the key it completes
+	bool			break_pending;
 
-	// Its number of elements
-	uint64_t		set_len;
+	// Typematic coalescing, see ps2_coalesce_repeat(): the last pressed record while its key is held,
+	// its repeats since then being counted in `repeat.repeats`
+	struct keyboard_driver_record	repeat;
+	bool			repeat_held;
+};
+
+enum	ps2_decode_status {
+	// The byte does not continue any code of the set, the pending code is to be dropped
+	PS2_DECODE_INVALID,
+	// More bytes are needed to complete the pending code
+	PS2_DECODE_PENDING,
+	// The pending code is a complete key code
+	PS2_DECODE_COMPLETE
 };
 
 void			ps2_reset_pending_code(struct ps2_keyboard_state *state);
 bool			ps2_add_to_pending_code(struct ps2_keyboard_state *state, uint8_t code);
 bool			ps2_code_is_pending(struct ps2_keyboard_state *state);
 bool		    	ps2_maybe_in_scan_set(struct ps2_keyboard_state *state, uint8_t code);
-struct scan_key_code	*ps2_find_scan_key_code(struct ps2_keyboard_state *state);
-bool			ps2_catch_modifiers(struct ps2_keyboard_state *state, struct scan_key_code *key);
-char			ps2_key_name_with_modifiers(struct ps2_keyboard_state *state, struct scan_key_code *key_id);
-
-/*
-   Modifier callbacks
- */
-
-typedef bool	(*ps2_modifier_callback_t)(struct ps2_keyboard_state *state, struct scan_key_code *key);
-
-
-
+enum ps2_decode_status	ps2_decode_byte(struct ps2_keyboard_state *state, uint8_t code);
+const struct scan_key_code	*ps2_find_scan_key_code(struct ps2_keyboard_state *state);
+enum ps2_key_state	ps2_key_state(const struct ps2_keyboard_state *state, const struct scan_key_code *key);
+bool			ps2_catch_modifiers(struct ps2_keyboard_state *state, const struct scan_key_code *key);
+char			ps2_key_name_with_modifiers(struct ps2_keyboard_state *state, const struct scan_key_code *key_id);
+void			ps2_fill_record(struct ps2_keyboard_state *state, const struct scan_key_code *key_id,
+					struct keyboard_driver_record *record);
+bool			ps2_coalesce_repeat(struct ps2_keyboard_state *state, const struct keyboard_driver_record *record,
+					    struct keyboard_driver_record *run);
 
 #endif /* __PS2_KEYBOARD_STATE_H__ */
@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: GPL-2.0
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "ps2_replay.h"
+#include "log_reader.h"
+
+/*
+  Replays a capture of the keyboard through the decoder of the driver.
+  usage: ps2_replay [-s 1|2|3] [-b | -l] [-p] [-c <interval>] [-a <event>]... <capture>
+  -s: scan code set of the capture, 1 by default
+  -b: the capture is made of binary records read from the device, else of the raw bytes of the keyboard
+  -l: the capture is a log_file written by the driver, whose entries are replayed as binary records
+  -p: prints every event
+  -c: events between two checkpoints
+  -a: prints the state of the keyboard once <event> events were replayed, may be repeated
+ */
+
+#define REPLAY_MAX_AT 64U
+
+static const char *const	modifier_names[16] = {
+	[15] = "capslock",
+	[14] = "left_shift",
+	[13] = "right_shift",
+	[12] = "left_alt",
+	[11] = "right_alt",
+	[10] = "escape",
+	[9] = "left_ctrl",
+	[8] = "right_ctrl",
+	[7] = "num_lock",
+	[6] = "scroll_lock",
+};
+
+struct	log_records {
+	struct keyboard_driver_record	*records;
+	size_t				len;
+	size_t				capacity;
+
+	// Sequence number of the next entry, and the entries missing from the log,
+	// evicted from the ring before they could be logged
+	uint64_t			next_seq;
+	uint64_t			missing;
+};
+
+static int	append_log_record(void *ctx, __u64 seq, const struct keyboard_driver_record *record)
+{
+	struct log_records		*log = ctx;
+	struct keyboard_driver_record	*records;
+	size_t				capacity;
+
+	if (log->len == log->capacity) {
+		capacity = log->capacity ? log->capacity * 2 : 4096;
+		records = realloc(log->records, capacity * sizeof(*records));
+		if (records == NULL)
+			return -ENOMEM;
+		log->records = records;
+		log->capacity = capacity;
+	}
+	if (log->len != 0 && seq > log->next_seq)
+		log->missing += seq - log->next_seq;
+	log->next_seq = seq + 1;
+	log->records[log->len++] = *record;
+	return 0;
+}
+
+/*
+  Decodes every entry of the log at `path` into `log`, in the layout of the binary records of the device
+ */
+static int	load_log(const char *path, struct log_records *log)
+{
+	struct keyboard_driver_log_block	header;
+	struct log_reader			reader;
+	off_t					offset = 0;
+	int					ret;
+
+	memset(log, 0, sizeof(*log));
+	if (log_reader_open(&reader, path))
+		return -1;
+	while (0 == (ret = log_reader_header(&reader, offset, &header))) {
+		offset += sizeof(header);
+		ret = log_reader_decode_block(&reader, &header, offset, &append_log_record, log);
+		if (ret)
+			break;
+		offset += header.size;
+	}
+	log_reader_close(&reader);
+	if (ret == -ENOMEM)
+		ERR("Failed to allocate %zu records", log->len);
+	return ret < 0 ? -1 : 0;
+}
+
+static uint64_t	now_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void	print_record(uint64_t event, const struct keyboard_driver_record *record)
+{
+	const char	*name = scan_code_key_names[record->key_id];
+
+	printf("%llu %#llx %s %s %#hx %c", event, record->code, name ? name : "?",
+		record->flags & KEYBOARD_DRIVER_RECORD_REPEAT ? "Repeated"
+			: record->state == RELEASED ? "Released" : "Pressed",
+		record->modifiers,
+		record->ascii_value >= ' ' && record->ascii_value <= '~' ? record->ascii_value : '.');
+	if (record->flags & KEYBOARD_DRIVER_RECORD_REPEAT)
+		printf(" x%u", record->repeats);
+	printf("\n");
+}
+
+static void	print_state(const struct ps2_keyboard_state *state, uint64_t event)
+{
+	unsigned int	bit;
+
+	printf("after %llu events: modifiers", event);
+	for (bit = 0; bit < 16; bit++) {
+		if (state->flags & (1U << bit) && modifier_names[bit] != NULL)
+			printf(" %s", modifier_names[bit]);
+	}
+	if (state->code_pending)
+		printf(", pending code %#llx", state->pending_code);
+	printf("\n");
+}
+
+static void	usage(const char *name)
+{
+	fprintf(stderr, "usage: %s [-s 1|2|3] [-b | -l] [-p] [-c <interval>] [-a <event>]... <capture>\n", name);
+	exit(EXIT_FAILURE);
+}
+
+int	main(int argc, char **argv)
+{
+	const struct scan_code_set	*set = &scan_code_set_1;
+	enum ps2_replay_input		input = PS2_REPLAY_RAW;
+	struct keyboard_driver_record	record;
+	struct ps2_replay		replay;
+	struct log_records		log;
+	bool				from_log = false;
+	uint64_t			interval = 4096;
+	uint64_t			at[REPLAY_MAX_AT];
+	unsigned int			at_len = 0;
+	unsigned int			i;
+	bool				print = false;
+	struct stat			st;
+	void				*data;
+	uint64_t			start;
+	uint64_t			elapsed;
+	int				opt;
+	int				fd;
+
+	while ((opt = getopt(argc, argv, "s:blpc:a:")) != -1) {
+		switch (opt) {
+		case 's':
+			if (!strcmp(optarg, "1"))
+				set = &scan_code_set_1;
+			else if (!strcmp(optarg, "2"))
+				set = &scan_code_set_2;
+			else if (!strcmp(optarg, "3"))
+				set = &scan_code_set_3;
+			else
+				usage(argv[0]);
+			break;
+		case 'b':
+			input = PS2_REPLAY_RECORDS;
+			break;
+		case 'l':
+			input = PS2_REPLAY_RECORDS;
+			from_log = true;
+			break;
+		case 'p':
+			print = true;
+			break;
+		case 'c':
+			interval = strtoull(optarg, NULL, 0);
+			break;
+		case 'a':
+			if (at_len == REPLAY_MAX_AT)
+				usage(argv[0]);
+			at[at_len++] = strtoull(optarg, NULL, 0);
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (optind != argc - 1)
+		usage(argv[0]);
+	if (from_log) {
+		if (load_log(argv[optind], &log))
+			return EXIT_FAILURE;
+		if (log.missing != 0)
+			fprintf(stderr, "%llu entries are missing from the log\n", (unsigned long long)log.missing);
+		data = log.records;
+		st.st_size = log.len * sizeof(*log.records);
+	} else {
+		fd = open(argv[optind], O_RDONLY);
+		if (fd < 0 || fstat(fd, &st) < 0) {
+			perror(argv[optind]);
+			return EXIT_FAILURE;
+		}
+		data = st.st_size ? mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0) : NULL;
+		close(fd);
+		if (data == MAP_FAILED) {
+			perror(argv[optind]);
+			return EXIT_FAILURE;
+		}
+	}
+	if (ps2_replay_init(&replay, input, set, data, st.st_size, interval)) {
+		fprintf(stderr, "Failed to start the replay\n");
+		return EXIT_FAILURE;
+	}
+
+	start = now_ns();
+	while (ps2_replay_next(&replay, &record)) {
+		if (print)
+			print_record(replay.events - 1, &record);
+	}
+	elapsed = now_ns() - start;
+	fprintf(stderr, "%llu events, %llu invalid, %llu mismatches, %zu bytes in %.3f ms: %.1f Mevents/s, %.1f MB/s\n",
+		replay.events, replay.invalid, replay.mismatches, replay.size, elapsed / 1e6,
+		elapsed ? replay.events * 1e3 / elapsed : 0, elapsed ? replay.size * 1e3 / elapsed : 0);
+
+	if (replay.checkpoint_failures != 0)
+		fprintf(stderr, "%llu checkpoints could not be allocated, seeks replay more events\n",
+			replay.checkpoint_failures);
+
+	// Seeks backward reuse the checkpoints taken by the full replay
+	for (i = 0; i < at_len; i++)
+		print_state(&replay.state, ps2_replay_seek(&replay, at[i]));
+
+	ps2_replay_destroy(&replay);
+	if (from_log)
+		free(log.records);
+	else if (data != NULL)
+		munmap(data, st.st_size);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: GPL-2.0
+#include "ps2_replay.h"
+
+static int	ps2_replay_checkpoint(struct ps2_replay *replay)
+{
+	struct ps2_replay_checkpoint	*checkpoints;
+	size_t				capacity;
+
+	if (replay->checkpoints_len == replay->checkpoints_capacity) {
+		capacity = replay->checkpoints_capacity ? replay->checkpoints_capacity * 2 : 64;
+		checkpoints = realloc(replay->checkpoints, capacity * sizeof(*checkpoints));
+		if (checkpoints == NULL)
+			return -ENOMEM;
+		replay->checkpoints = checkpoints;
+		replay->checkpoints_capacity = capacity;
+	}
+	checkpoints = &replay->checkpoints[replay->checkpoints_len++];
+	checkpoints->event = replay->events;
+	checkpoints->offset = replay->offset;
+	checkpoints->state = replay->state;
+	return 0;
+}
+
+int		ps2_replay_init(struct ps2_replay *replay, enum ps2_replay_input input, const struct scan_code_set *set,
+				const uint8_t *data, size_t size, uint64_t checkpoint_interval)
+{
+	if (checkpoint_interval == 0)
+		return -EINVAL;
+	memset(replay, 0, sizeof(*replay));
+	replay->state.scan_code_set = set;
+	ps2_reset_pending_code(&replay->state);
+	replay->input = input;
+	replay->data = data;
+	replay->size = size;
+	replay->checkpoint_interval = checkpoint_interval;
+	return ps2_replay_checkpoint(replay);
+}
+
+void		ps2_replay_destroy(struct ps2_replay *replay)
+{
+	free(replay->checkpoints);
+	replay->checkpoints = NULL;
+}
+
+/*
+  Same decoding as keyboard_decode() in the driver
+ */
+static bool	ps2_replay_next_raw(struct ps2_replay *replay, struct keyboard_driver_record *record)
+{
+	const struct scan_key_code	*key;
+
+	while (replay->offset < replay->size) {
+		switch (ps2_decode_byte(&replay->state, replay->data[replay->offset++])) {
+		case PS2_DECODE_INVALID:
+			replay->invalid++;
+			ps2_reset_pending_code(&replay->state);
+			break;
+		case PS2_DECODE_PENDING:
+			break;
+		case PS2_DECODE_COMPLETE:
+			key = ps2_find_scan_key_code(&replay->state);
+			ps2_fill_record(&replay->state, key, record);
+			record->timestamp = 0;
+			ps2_reset_pending_code(&replay->state);
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+  Decodes the code of a record as the bytes the keyboard sent, which may hold the break prefix of the set.
+  Returns NULL if it is not a complete code of the set.
+ */
+static const struct scan_key_code	*ps2_replay_decode_code(struct ps2_keyboard_state *state, uint64_t code)
+{
+	enum ps2_decode_status	status = PS2_DECODE_INVALID;
+	uint8_t			len = scan_key_code_len(code);
+
+	while (len-- != 0) {
+		status = ps2_decode_byte(state, code >> (len * 8U));
+		if (status == PS2_DECODE_INVALID || (status == PS2_DECODE_COMPLETE && len != 0))
+			return NULL;
+	}
+	if (status != PS2_DECODE_COMPLETE)
+		return NULL;
+	return ps2_find_scan_key_code(state);
+}
+
+static bool	ps2_replay_next_record(struct ps2_replay *replay, struct keyboard_driver_record *record)
+{
+	const struct scan_key_code	*key;
+	uint16_t			modifiers;
+	uint8_t				flags;
+	uint16_t			repeats;
+
+	while (replay->size - replay->offset >= sizeof(*record)) {
+		memcpy(record, replay->data + replay->offset, sizeof(*record));
+		replay->offset += sizeof(*record);
+		key = ps2_replay_decode_code(&replay->state, record->code);
+		if (key == NULL) {
+			ps2_reset_pending_code(&replay->state);
+			replay->invalid++;
+			continue;
+		}
+		modifiers = record->modifiers;
+		flags = record->flags;
+		repeats = record->repeats;
+		ps2_fill_record(&replay->state, key, record);
+		ps2_reset_pending_code(&replay->state);
+		// A KEYBOARD_DRIVER_RECORD_REPEAT record stands for its run, which is not derived from its code
+		record->flags = flags;
+		record->repeats = repeats;
+		// The capture may have started with locks on, or may miss events
+		if (record->modifiers != modifiers)
+			replay->mismatches++;
+		return true;
+	}
+	return false;
+}
+
+/*
+  Replays the input up to the next key event, returns false at the end of the input
+ */
+bool		ps2_replay_next(struct ps2_replay *replay, struct keyboard_driver_record *record)
+{
+	struct ps2_replay_checkpoint	*last = &replay->checkpoints[replay->checkpoints_len - 1];
+	bool				produced;
+
+	if (replay->events >= last->event + replay->checkpoint_interval && ps2_replay_checkpoint(replay) != 0)
+		replay->checkpoint_failures++;
+	if (replay->input == PS2_REPLAY_RAW)
+		produced = ps2_replay_next_raw(replay, record);
+	else
+		produced = ps2_replay_next_record(replay, record);
+	if (produced)
+		replay->events++;
+	return produced;
+}
+
+/*
+  Reconstructs the state of the keyboard once `event` events were replayed, from the closest checkpoint.
+  Returns the number of events replayed, less than `event` if the input is shorter.
+ */
+uint64_t	ps2_replay_seek(struct ps2_replay *replay, uint64_t event)
+{
+	struct ps2_replay_checkpoint	*checkpoint;
+	struct keyboard_driver_record	record;
+	size_t				low = 0;
+	size_t				high = replay->checkpoints_len;
+	size_t				mid;
+
+	// Last checkpoint at or before `event`, the first one is at event 0
+	while (high - low > 1) {
+		mid = low + (high - low) / 2;
+		if (replay->checkpoints[mid].event <= event)
+			low = mid;
+		else
+			high = mid;
+	}
+	checkpoint = &replay->checkpoints[low];
+	if (replay->events < checkpoint->event || replay->events > event) {
+		replay->events = checkpoint->event;
+		replay->offset = checkpoint->offset;
+		replay->state = checkpoint->state;
+	}
+	while (replay->events < event && ps2_replay_next(replay, &record))
+		;
+	return replay->events;
+}
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: GPL-2.0
+#ifndef __PS2_REPLAY_H__
+# define __PS2_REPLAY_H__
+
+# include "ps2_keyboard_state.h"
+
+enum	ps2_replay_input {
+	// Bytes as read from the keyboard, decoded as the interrupt thread does
+	PS2_REPLAY_RAW,
+	// `struct keyboard_driver_record`s as read from the device in binary mode, the modifiers are derived again
+	PS2_REPLAY_RECORDS
+};
+
+/*
+  State of the keyboard before the event of index `event`, which starts at `offset` in the input
+ */
+struct	ps2_replay_checkpoint {
+	uint64_t			event;
+	size_t				offset;
+	struct ps2_keyboard_state	state;
+};
+
+/*
+  Replays a capture through the decoder and the modifier logic of the driver.
+  A checkpoint is taken every `checkpoint_interval` events, so that the state of the keyboard at
+  any event is reconstructed by replaying at most `checkpoint_interval` events.
+ */
+struct	ps2_replay {
+	struct ps2_keyboard_state	state;
+	enum ps2_replay_input		input;
+	const uint8_t			*data;
+	size_t				size;
+	size_t				offset;
+
+	// Number of key events produced
+	uint64_t			events;
+
+	// Number of bytes dropped by the decoder, or of records whose code is not in the set
+	uint64_t			invalid;
+
+	// Number of records whose recorded modifiers differ from the derived ones
+	uint64_t			mismatches;
+
+	// Number of checkpoints which could not be allocated, each is taken again at the next event
+	uint64_t			checkpoint_failures;
+
+	struct ps2_replay_checkpoint	*checkpoints;
+	size_t				checkpoints_len;
+	size_t				checkpoints_capacity;
+	uint64_t			checkpoint_interval;
+};
+
+int		ps2_replay_init(struct ps2_replay *replay, enum ps2_replay_input input, const struct scan_code_set *set,
+				const uint8_t *data, size_t size, uint64_t checkpoint_interval);
+void		ps2_replay_destroy(struct ps2_replay *replay);
+bool		ps2_replay_next(struct ps2_replay *replay, struct keyboard_driver_record *record);
+uint64_t	ps2_replay_seek(struct ps2_replay *replay, uint64_t event);
+
+#endif /* __PS2_REPLAY_H__ */
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: GPL-2.0
 #include "scan_code_sets.h"
+#include "scan_code_tables.h"
 
 #define LOG __FILE__": "
 
@@ -17,7 +18,10 @@ PURE char	*ps2_key_state_to_string(enum ps2_key_state state)
 	return NULL;
 }
 
-struct scan_key_code *find_scan_key_code(struct scan_key_code *set, uint64_t set_len, uint64_t code)
+/*
+  Reference linear lookup, the index and the automaton of the generated sets are checked against it.
+ */
+const struct scan_key_code *find_scan_key_code(const struct scan_key_code *set, uint64_t set_len, uint64_t code)
 {
 	uint64_t    i;
 
@@ -30,42 +34,97 @@ struct scan_key_code *find_scan_key_code(struct scan_key_code *set, uint64_t set
 	return NULL;
 }
 
-static uint8_t	get_nth_byte_in_key_code(struct scan_key_code *set, uint8_t n)
+bool		key_code_has_ascii_value(const struct scan_key_code *key_code)
 {
-	uint64_t    i = 0;
-	uint64_t    byte;
+	return key_code->ascii_value != 0x0;
+}
 
-	while (i < sizeof(uint64_t)) {
-//		printk(KERN_INFO LOG "%lld: %llx\n", i, (set->code & (0xFF00000000000000 >> (i * 8UL))));
-		if ((set->code & (0xFF00000000000000 >> (i * 8UL))) != 0) {
-			byte = (set->code & (0xFF00000000000000 >> (i * 8UL)));
-			return byte >> (7U - (i + n)) * 8UL;
-		}
+const struct scan_key_code *find_scan_key_code_indexed(const struct scan_code_index *index, uint64_t code)
+{
+	uint8_t	    i;
+
+	switch (code >> 8U) {
+	case 0x0:
+		return index->single[code];
+	case 0xE0:
+		return index->extended[0][code & 0xFF];
+	case 0xE1:
+		return index->extended[1][code & 0xFF];
+	default:
+		break;
+	}
+	i = 0;
+	while (i < index->long_codes_len) {
+		if (index->long_codes[i]->code == code)
+			return index->long_codes[i];
 		i++;
 	}
-//	printk(KERN_WARNING LOG "return this\n");
-	return 0x0;
+	return NULL;
 }
 
-bool		maybe_in_scan_set(struct scan_key_code *set, uint64_t set_len, uint64_t code, uint8_t current_index)
+/*
+  Checks that the index resolves every code of `set` to the same entry as the reference linear lookup.
+ */
+bool		check_scan_code_index(const struct scan_code_set *set)
 {
 	uint64_t    i;
-	uint8_t	    byte;
 
 	i = 0;
-	WARN_ON(current_index > sizeof(uint64_t));
-	while (i < set_len) {
-		byte = get_nth_byte_in_key_code(&set[i], current_index);
-		/* printk(KERN_INFO LOG "byte: %x at index: %d\n", byte, current_index); */
-		/* printk(KERN_INFO LOG "%llx == %x\n", code, byte); */
-		if (code == byte)
-			return true;
+	while (i < set->len) {
+		if (find_scan_key_code_indexed(set->index, set->keys[i].code)
+			!= find_scan_key_code(set->keys, set->len, set->keys[i].code)) {
+			printk(KERN_WARNING LOG "Scan code index mismatch for code %#llx\n", set->keys[i].code);
+			return false;
+		}
 		i++;
 	}
-	return false;
+	return true;
 }
 
-bool		key_code_has_ascii_value(struct scan_key_code *key_code)
+/*
+  Number of bytes the keyboard sends for `code`.
+ */
+PURE uint8_t	scan_key_code_len(uint64_t code)
 {
-	return key_code->ascii_value != 0x0;
+	uint8_t	    len = 1;
+
+	while (len < sizeof(uint64_t) && (code >> (len * 8U)) != 0)
+		len++;
+	return len;
+}
+
+/*
+  Checks that walking the automaton over the bytes of every code of `set` completes
+  on the same entry as the reference linear lookup, and not before its last byte.
+ */
+bool		check_scan_code_automaton(const struct scan_code_set *set)
+{
+	const struct scan_key_code	*key;
+	uint64_t			i;
+	uint16_t			transition;
+	uint8_t				len;
+	uint8_t				n;
+
+	i = 0;
+	while (i < set->len) {
+		key = &set->keys[i];
+		len = scan_key_code_len(key->code);
+		transition = SCAN_CODE_AUTOMATON_ROOT;
+		n = 0;
+		while (n < len) {
+			if (transition & SCAN_CODE_TRANSITION_ACCEPT)
+				break;
+			transition = set->automaton->transitions[transition][(key->code >> ((len - n - 1U) * 8U)) & 0xFF];
+			if (transition == SCAN_CODE_TRANSITION_INVALID)
+				break;
+			n++;
+		}
+		if (n != len || !(transition & SCAN_CODE_TRANSITION_ACCEPT)
+			|| &set->keys[transition & ~SCAN_CODE_TRANSITION_ACCEPT] != find_scan_key_code(set->keys, set->len, key->code)) {
+			printk(KERN_WARNING LOG "Scan code automaton mismatch for code %#llx\n", key->code);
+			return false;
+		}
+		i++;
+	}
+	return true;
 }
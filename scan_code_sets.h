@@ -12,46 +12,118 @@ enum	ps2_key_state {
 	RELEASED
 };
 
+enum	ps2_modifier {
+	PS2_MODIFIER_NONE,
+	PS2_MODIFIER_ESCAPE,
+	PS2_MODIFIER_LEFT_CONTROL,
+	PS2_MODIFIER_RIGHT_CONTROL,
+	PS2_MODIFIER_LEFT_SHIFT,
+	PS2_MODIFIER_RIGHT_SHIFT,
+	PS2_MODIFIER_CAPSLOCK,
+	PS2_MODIFIER_NUMBER_LOCK,
+	PS2_MODIFIER_SCROLL_LOCK,
+	PS2_MODIFIER_LEFT_ALT,
+	PS2_MODIFIER_RIGHT_ALT,
+	PS2_MODIFIER_COUNT
+};
+
 struct scan_key_code {
 	uint64_t		code;
-	char		        *key_name;
+	const char		*key_name;
 
 	// State of the key press
 	enum ps2_key_state	state;
 
 	// ascii value, if any, else (char)0x0
 	char			ascii_value;
+
+	// enum ps2_modifier the key acts on, if any
+	uint8_t			modifier;
+
+	// Compact identifier of the physical key, shared by its pressed and released codes and by every set
+	uint8_t			id;
+};
+
+# define SCAN_CODE_MAX_KEY_IDS 256U
+
+/*
+  Name of each key id, NULL for the ids that are not in use
+ */
+extern const char *const	scan_code_key_names[SCAN_CODE_MAX_KEY_IDS];
+
+# define SCAN_CODE_INDEX_MAX_LONG_CODES 8U
+
+/*
+  Constant time lookup index over a scan code set.
+  Single byte codes directly index `single`, two bytes codes prefixed by 0xE0 or 0xE1 index `extended`
+  by their last byte, and the few remaining longer codes (print screen, pause) live in `long_codes`,
+  which is bounded by SCAN_CODE_INDEX_MAX_LONG_CODES.
+ */
+struct scan_code_index {
+	const struct scan_key_code	*single[256];
+	const struct scan_key_code	*extended[2][256];
+	const struct scan_key_code	*long_codes[SCAN_CODE_INDEX_MAX_LONG_CODES];
+	uint8_t			long_codes_len;
 };
 
-struct	key_entry {
-	// index inside the scan code set
-	struct scan_key_code	*key_id;
+# define SCAN_CODE_AUTOMATON_MAX_STATES 16U
+# define SCAN_CODE_AUTOMATON_ROOT 0U
+
+# define SCAN_CODE_TRANSITION_INVALID 0x0U
+# define SCAN_CODE_TRANSITION_ACCEPT 0x8000U
+
+/*
+  Prefix automaton (a trie) of a scan code set, walked one byte at a time.
+  Each transition is either SCAN_CODE_TRANSITION_INVALID, the index of the next state,
+  or SCAN_CODE_TRANSITION_ACCEPT | the index of the completed key in the set.
+  The root state is never the target of a transition, hence 0 can mean invalid.
+ */
+struct scan_code_automaton {
+	uint16_t		transitions[SCAN_CODE_AUTOMATON_MAX_STATES][256];
+	uint8_t			states_len;
+};
 
-	// Data at which the entry was performed
-	struct timeval		date;
+/*
+  A scan code set along with its lookup structures.
+  They are all generated at compile time into scan_code_tables.h by gen_scan_code_set_table.
+ */
+struct scan_code_set {
+	const struct scan_key_code		*keys;
+	uint64_t				len;
+	const struct scan_code_index		*index;
+	const struct scan_code_automaton	*automaton;
 
-	struct list_head	head;
+	// Byte sent before the last byte of a make code to turn it into its break code, 0 if the set has none.
+	// Such break codes are not in `keys`, the decoder tracks the prefix and reports the key as released.
+	uint8_t					break_prefix;
 };
 
 /*
   First scan code set of the PS/2 keyboards
  */
 
-extern struct scan_key_code	scan_code_set_1[];
+extern const struct scan_code_set	scan_code_set_1;
+
+/*
+  Second scan code set of the PS/2 keyboards, their native one, as seen with the i8042 translation disabled
+ */
+
+extern const struct scan_code_set	scan_code_set_2;
 
 /*
-  Second scan code set of the PS/2 keyboards
+  Third scan code set of the PS/2 keyboards, with every key in make/break mode
  */
 
-extern struct scan_key_code	    scan_code_set_2[];
+extern const struct scan_code_set	scan_code_set_3;
 
 char			*ps2_key_state_to_string(enum ps2_key_state state);
-struct scan_key_code	*find_scan_key_code(struct scan_key_code *set,
-					uint64_t set_len,
-					uint64_t code);
-bool			maybe_in_scan_set(struct scan_key_code *set,
-				uint64_t set_len,
-				uint64_t code,
-				uint8_t current_index);
-bool			key_code_has_ascii_value(struct scan_key_code *key_code);
+const struct scan_key_code	*find_scan_key_code(const struct scan_key_code *set,
+						uint64_t set_len,
+						uint64_t code);
+bool			key_code_has_ascii_value(const struct scan_key_code *key_code);
+const struct scan_key_code	*find_scan_key_code_indexed(const struct scan_code_index *index,
+							uint64_t code);
+uint8_t			scan_key_code_len(uint64_t code);
+bool			check_scan_code_index(const struct scan_code_set *set);
+bool			check_scan_code_automaton(const struct scan_code_set *set);
 #endif /* __SCAN_CODE_SETS_H__ */
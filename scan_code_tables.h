@@ -0,0 +1,1872 @@
+// SPDX-License-Identifier: GPL-2.0
+/*
+  Generated by gen_scan_code_set_table from:
+  gen_scan_code_set_table/scan_code_set_1.txt
+  gen_scan_code_set_table/scan_code_set_2.txt
+  gen_scan_code_set_table/scan_code_set_3.txt
+  Do not edit, run `make tables` instead.
+ */
+#ifndef __SCAN_CODE_TABLES_H__
+# define __SCAN_CODE_TABLES_H__
+
+# include "scan_code_sets.h"
+
+static const char	scan_code_names[] =
+	"escape" "\0" // 0, key id 0
+	"1" "\0" // 7, key id 1
+	"2" "\0" // 9, key id 2
+	"3" "\0" // 11, key id 3
+	"4" "\0" // 13, key id 4
+	"5" "\0" // 15, key id 5
+	"6" "\0" // 17, key id 6
+	"7" "\0" // 19, key id 7
+	"8" "\0" // 21, key id 8
+	"9" "\0" // 23, key id 9
+	"0 (zero)" "\0" // 25, key id 10
+	"-" "\0" // 34, key id 11
+	"=" "\0" // 36, key id 12
+	"backspace" "\0" // 38, key id 13
+	"tab" "\0" // 48, key id 14
+	"Q" "\0" // 52, key id 15
+	"W" "\0" // 54, key id 16
+	"E" "\0" // 56, key id 17
+	"R" "\0" // 58, key id 18
+	"T" "\0" // 60, key id 19
+	"Y" "\0" // 62, key id 20
+	"U" "\0" // 64, key id 21
+	"I" "\0" // 66, key id 22
+	"O" "\0" // 68, key id 23
+	"P" "\0" // 70, key id 24
+	"[" "\0" // 72, key id 25
+	"]" "\0" // 74, key id 26
+	"enter" "\0" // 76, key id 27
+	"left control" "\0" // 82, key id 28
+	"A" "\0" // 95, key id 29
+	"S" "\0" // 97, key id 30
+	"D" "\0" // 99, key id 31
+	"F" "\0" // 101, key id 32
+	"G" "\0" // 103, key id 33
+	"H" "\0" // 105, key id 34
+	"J" "\0" // 107, key id 35
+	"K" "\0" // 109, key id 36
+	"L" "\0" // 111, key id 37
+	";" "\0" // 113, key id 38
+	"' (single quote)" "\0" // 115, key id 39
+	"` (back tick)" "\0" // 132, key id 40
+	"left shift" "\0" // 146, key id 41
+	"\\" "\0" // 157, key id 42
+	"Z" "\0" // 159, key id 43
+	"X" "\0" // 161, key id 44
+	"C" "\0" // 163, key id 45
+	"V" "\0" // 165, key id 46
+	"B" "\0" // 167, key id 47
+	"N" "\0" // 169, key id 48
+	"M" "\0" // 171, key id 49
+	"," "\0" // 173, key id 50
+	"." "\0" // 175, key id 51
+	"/" "\0" // 177, key id 52
+	"right shift" "\0" // 179, key id 53
+	"(keypad) *" "\0" // 191, key id 54
+	"left alt" "\0" // 202, key id 55
+	"space" "\0" // 211, key id 56
+	"CapsLock" "\0" // 217, key id 57
+	"F1" "\0" // 226, key id 58
+	"F2" "\0" // 229, key id 59
+	"F3" "\0" // 232, key id 60
+	"F4" "\0" // 235, key id 61
+	"F5" "\0" // 238, key id 62
+	"F6" "\0" // 241, key id 63
+	"F7" "\0" // 244, key id 64
+	"F8" "\0" // 247, key id 65
+	"F9" "\0" // 250, key id 66
+	"F10" "\0" // 253, key id 67
+	"NumberLock" "\0" // 257, key id 68
+	"ScrollLock" "\0" // 268, key id 69
+	"(keypad) 7" "\0" // 279, key id 70
+	"(keypad) 8" "\0" // 290, key id 71
+	"(keypad) 9" "\0" // 301, key id 72
+	"(keypad) -" "\0" // 312, key id 73
+	"(keypad) 4" "\0" // 323, key id 74
+	"(keypad) 5" "\0" // 334, key id 75
+	"(keypad) 6" "\0" // 345, key id 76
+	"(keypad) +" "\0" // 356, key id 77
+	"(keypad) 1" "\0" // 367, key id 78
+	"(keypad) 2" "\0" // 378, key id 79
+	"(keypad) 3" "\0" // 389, key id 80
+	"(keypad) 0" "\0" // 400, key id 81
+	"(keypad) ." "\0" // 411, key id 82
+	"F11" "\0" // 422, key id 83
+	"F12" "\0" // 426, key id 84
+	"(multimedia) previous track" "\0" // 430, key id 85
+	"(multimedia) next track" "\0" // 458, key id 86
+	"(keypad) enter" "\0" // 482, key id 87
+	"right control" "\0" // 497, key id 88
+	"(multimedia) mute" "\0" // 511, key id 89
+	"(multimedia) calculator" "\0" // 529, key id 90
+	"(multimedia) play" "\0" // 553, key id 91
+	"(multimedia) stop" "\0" // 571, key id 92
+	"(multimedia) volume down" "\0" // 589, key id 93
+	"(multimedia) volume up" "\0" // 614, key id 94
+	"(multimedia) WWW home" "\0" // 637, key id 95
+	"(keypad) /" "\0" // 659, key id 96
+	"right alt (or altGr)" "\0" // 670, key id 97
+	"home" "\0" // 691, key id 98
+	"cursor up" "\0" // 696, key id 99
+	"page up" "\0" // 706, key id 100
+	"cursor left" "\0" // 714, key id 101
+	"cursor right" "\0" // 726, key id 102
+	"end" "\0" // 739, key id 103
+	"cursor down" "\0" // 743, key id 104
+	"page down" "\0" // 755, key id 105
+	"insert" "\0" // 765, key id 106
+	"delete" "\0" // 772, key id 107
+	"left GUI" "\0" // 779, key id 108
+	"right GUI" "\0" // 788, key id 109
+	"\"apps\"" "\0" // 798, key id 110
+	"(ACPI) power" "\0" // 805, key id 111
+	"(ACPI) sleep" "\0" // 818, key id 112
+	"(ACPI) wake" "\0" // 831, key id 113
+	"(multimedia) WWW search" "\0" // 843, key id 114
+	"(multimedia) WWW favorites" "\0" // 867, key id 115
+	"(multimedia) WWW refresh" "\0" // 894, key id 116
+	"(multimedia) WWW stop" "\0" // 919, key id 117
+	"(multimedia) WWW forward" "\0" // 941, key id 118
+	"(multimedia) WWW back" "\0" // 966, key id 119
+	"(multimedia) my computer" "\0" // 988, key id 120
+	"(multimedia) email" "\0" // 1013, key id 121
+	"(multimedia) media select" "\0" // 1032, key id 122
+	"print screen" "\0" // 1058, key id 123
+	"pause" "\0" // 1071, key id 124
+	;
+
+const char *const	scan_code_key_names[SCAN_CODE_MAX_KEY_IDS] = {
+	scan_code_names + 0, // 0: "escape"
+	scan_code_names + 7, // 1: "1"
+	scan_code_names + 9, // 2: "2"
+	scan_code_names + 11, // 3: "3"
+	scan_code_names + 13, // 4: "4"
+	scan_code_names + 15, // 5: "5"
+	scan_code_names + 17, // 6: "6"
+	scan_code_names + 19, // 7: "7"
+	scan_code_names + 21, // 8: "8"
+	scan_code_names + 23, // 9: "9"
+	scan_code_names + 25, // 10: "0 (zero)"
+	scan_code_names + 34, // 11: "-"
+	scan_code_names + 36, // 12: "="
+	scan_code_names + 38, // 13: "backspace"
+	scan_code_names + 48, // 14: "tab"
+	scan_code_names + 52, // 15: "Q"
+	scan_code_names + 54, // 16: "W"
+	scan_code_names + 56, // 17: "E"
+	scan_code_names + 58, // 18: "R"
+	scan_code_names + 60, // 19: "T"
+	scan_code_names + 62, // 20: "Y"
+	scan_code_names + 64, // 21: "U"
+	scan_code_names + 66, // 22: "I"
+	scan_code_names + 68, // 23: "O"
+	scan_code_names + 70, // 24: "P"
+	scan_code_names + 72, // 25: "["
+	scan_code_names + 74, // 26: "]"
+	scan_code_names + 76, // 27: "enter"
+	scan_code_names + 82, // 28: "left control"
+	scan_code_names + 95, // 29: "A"
+	scan_code_names + 97, // 30: "S"
+	scan_code_names + 99, // 31: "D"
+	scan_code_names + 101, // 32: "F"
+	scan_code_names + 103, // 33: "G"
+	scan_code_names + 105, // 34: "H"
+	scan_code_names + 107, // 35: "J"
+	scan_code_names + 109, // 36: "K"
+	scan_code_names + 111, // 37: "L"
+	scan_code_names + 113, // 38: ";"
+	scan_code_names + 115, // 39: "' (single quote)"
+	scan_code_names + 132, // 40: "` (back tick)"
+	scan_code_names + 146, // 41: "left shift"
+	scan_code_names + 157, // 42: "\\"
+	scan_code_names + 159, // 43: "Z"
+	scan_code_names + 161, // 44: "X"
+	scan_code_names + 163, // 45: "C"
+	scan_code_names + 165, // 46: "V"
+	scan_code_names + 167, // 47: "B"
+	scan_code_names + 169, // 48: "N"
+	scan_code_names + 171, // 49: "M"
+	scan_code_names + 173, // 50: ","
+	scan_code_names + 175, // 51: "."
+	scan_code_names + 177, // 52: "/"
+	scan_code_names + 179, // 53: "right shift"
+	scan_code_names + 191, // 54: "(keypad) *"
+	scan_code_names + 202, // 55: "left alt"
+	scan_code_names + 211, // 56: "space"
+	scan_code_names + 217, // 57: "CapsLock"
+	scan_code_names + 226, // 58: "F1"
+	scan_code_names + 229, // 59: "F2"
+	scan_code_names + 232, // 60: "F3"
+	scan_code_names + 235, // 61: "F4"
+	scan_code_names + 238, // 62: "F5"
+	scan_code_names + 241, // 63: "F6"
+	scan_code_names + 244, // 64: "F7"
+	scan_code_names + 247, // 65: "F8"
+	scan_code_names + 250, // 66: "F9"
+	scan_code_names + 253, // 67: "F10"
+	scan_code_names + 257, // 68: "NumberLock"
+	scan_code_names + 268, // 69: "ScrollLock"
+	scan_code_names + 279, // 70: "(keypad) 7"
+	scan_code_names + 290, // 71: "(keypad) 8"
+	scan_code_names + 301, // 72: "(keypad) 9"
+	scan_code_names + 312, // 73: "(keypad) -"
+	scan_code_names + 323, // 74: "(keypad) 4"
+	scan_code_names + 334, // 75: "(keypad) 5"
+	scan_code_names + 345, // 76: "(keypad) 6"
+	scan_code_names + 356, // 77: "(keypad) +"
+	scan_code_names + 367, // 78: "(keypad) 1"
+	scan_code_names + 378, // 79: "(keypad) 2"
+	scan_code_names + 389, // 80: "(keypad) 3"
+	scan_code_names + 400, // 81: "(keypad) 0"
+	scan_code_names + 411, // 82: "(keypad) ."
+	scan_code_names + 422, // 83: "F11"
+	scan_code_names + 426, // 84: "F12"
+	scan_code_names + 430, // 85: "(multimedia) previous track"
+	scan_code_names + 458, // 86: "(multimedia) next track"
+	scan_code_names + 482, // 87: "(keypad) enter"
+	scan_code_names + 497, // 88: "right control"
+	scan_code_names + 511, // 89: "(multimedia) mute"
+	scan_code_names + 529, // 90: "(multimedia) calculator"
+	scan_code_names + 553, // 91: "(multimedia) play"
+	scan_code_names + 571, // 92: "(multimedia) stop"
+	scan_code_names + 589, // 93: "(multimedia) volume down"
+	scan_code_names + 614, // 94: "(multimedia) volume up"
+	scan_code_names + 637, // 95: "(multimedia) WWW home"
+	scan_code_names + 659, // 96: "(keypad) /"
+	scan_code_names + 670, // 97: "right alt (or altGr)"
+	scan_code_names + 691, // 98: "home"
+	scan_code_names + 696, // 99: "cursor up"
+	scan_code_names + 706, // 100: "page up"
+	scan_code_names + 714, // 101: "cursor left"
+	scan_code_names + 726, // 102: "cursor right"
+	scan_code_names + 739, // 103: "end"
+	scan_code_names + 743, // 104: "cursor down"
+	scan_code_names + 755, // 105: "page down"
+	scan_code_names + 765, // 106: "insert"
+	scan_code_names + 772, // 107: "delete"
+	scan_code_names + 779, // 108: "left GUI"
+	scan_code_names + 788, // 109: "right GUI"
+	scan_code_names + 798, // 110: "\"apps\""
+	scan_code_names + 805, // 111: "(ACPI) power"
+	scan_code_names + 818, // 112: "(ACPI) sleep"
+	scan_code_names + 831, // 113: "(ACPI) wake"
+	scan_code_names + 843, // 114: "(multimedia) WWW search"
+	scan_code_names + 867, // 115: "(multimedia) WWW favorites"
+	scan_code_names + 894, // 116: "(multimedia) WWW refresh"
+	scan_code_names + 919, // 117: "(multimedia) WWW stop"
+	scan_code_names + 941, // 118: "(multimedia) WWW forward"
+	scan_code_names + 966, // 119: "(multimedia) WWW back"
+	scan_code_names + 988, // 120: "(multimedia) my computer"
+	scan_code_names + 1013, // 121: "(multimedia) email"
+	scan_code_names + 1032, // 122: "(multimedia) media select"
+	scan_code_names + 1058, // 123: "print screen"
+	scan_code_names + 1071, // 124: "pause"
+};
+
+static const struct scan_key_code	scan_code_set_1_keys[] = {
+	{ 0x1, scan_code_names + 0, PRESSED, 0x0, PS2_MODIFIER_ESCAPE, 0 }, // 0: "escape"
+	{ 0x2, scan_code_names + 7, PRESSED, '1', PS2_MODIFIER_NONE, 1 }, // 1: "1"
+	{ 0x3, scan_code_names + 9, PRESSED, '2', PS2_MODIFIER_NONE, 2 }, // 2: "2"
+	{ 0x4, scan_code_names + 11, PRESSED, '3', PS2_MODIFIER_NONE, 3 }, // 3: "3"
+	{ 0x5, scan_code_names + 13, PRESSED, '4', PS2_MODIFIER_NONE, 4 }, // 4: "4"
+	{ 0x6, scan_code_names + 15, PRESSED, '5', PS2_MODIFIER_NONE, 5 }, // 5: "5"
+	{ 0x7, scan_code_names + 17, PRESSED, '6', PS2_MODIFIER_NONE, 6 }, // 6: "6"
+	{ 0x8, scan_code_names + 19, PRESSED, '7', PS2_MODIFIER_NONE, 7 }, // 7: "7"
+	{ 0x9, scan_code_names + 21, PRESSED, '8', PS2_MODIFIER_NONE, 8 }, // 8: "8"
+	{ 0xa, scan_code_names + 23, PRESSED, '9', PS2_MODIFIER_NONE, 9 }, // 9: "9"
+	{ 0xb, scan_code_names + 25, PRESSED, '0', PS2_MODIFIER_NONE, 10 }, // 10: "0 (zero)"
+	{ 0xc, scan_code_names + 34, PRESSED, '-', PS2_MODIFIER_NONE, 11 }, // 11: "-"
+	{ 0xd, scan_code_names + 36, PRESSED, '=', PS2_MODIFIER_NONE, 12 }, // 12: "="
+	{ 0xe, scan_code_names + 38, PRESSED, 0x0, PS2_MODIFIER_NONE, 13 }, // 13: "backspace"
+	{ 0xf, scan_code_names + 48, PRESSED, '\t', PS2_MODIFIER_NONE, 14 }, // 14: "tab"
+	{ 0x10, scan_code_names + 52, PRESSED, 'q', PS2_MODIFIER_NONE, 15 }, // 15: "Q"
+	{ 0x11, scan_code_names + 54, PRESSED, 'w', PS2_MODIFIER_NONE, 16 }, // 16: "W"
+	{ 0x12, scan_code_names + 56, PRESSED, 'e', PS2_MODIFIER_NONE, 17 }, // 17: "E"
+	{ 0x13, scan_code_names + 58, PRESSED, 'r', PS2_MODIFIER_NONE, 18 }, // 18: "R"
+	{ 0x14, scan_code_names + 60, PRESSED, 't', PS2_MODIFIER_NONE, 19 }, // 19: "T"
+	{ 0x15, scan_code_names + 62, PRESSED, 'y', PS2_MODIFIER_NONE, 20 }, // 20: "Y"
+	{ 0x16, scan_code_names + 64, PRESSED, 'u', PS2_MODIFIER_NONE, 21 }, // 21: "U"
+	{ 0x17, scan_code_names + 66, PRESSED, 'i', PS2_MODIFIER_NONE, 22 }, // 22: "I"
+	{ 0x18, scan_code_names + 68, PRESSED, 'o', PS2_MODIFIER_NONE, 23 }, // 23: "O"
+	{ 0x19, scan_code_names + 70, PRESSED, 'p', PS2_MODIFIER_NONE, 24 }, // 24: "P"
+	{ 0x1a, scan_code_names + 72, PRESSED, '[', PS2_MODIFIER_NONE, 25 }, // 25: "["
+	{ 0x1b, scan_code_names + 74, PRESSED, ']', PS2_MODIFIER_NONE, 26 }, // 26: "]"
+	{ 0x1c, scan_code_names + 76, PRESSED, '\n', PS2_MODIFIER_NONE, 27 }, // 27: "enter"
+	{ 0x1d, scan_code_names + 82, PRESSED, 0x0, PS2_MODIFIER_LEFT_CONTROL, 28 }, // 28: "left control"
+	{ 0x1e, scan_code_names + 95, PRESSED, 'a', PS2_MODIFIER_NONE, 29 }, // 29: "A"
+	{ 0x1f, scan_code_names + 97, PRESSED, 's', PS2_MODIFIER_NONE, 30 }, // 30: "S"
+	{ 0x20, scan_code_names + 99, PRESSED, 'd', PS2_MODIFIER_NONE, 31 }, // 31: "D"
+	{ 0x21, scan_code_names + 101, PRESSED, 'f', PS2_MODIFIER_NONE, 32 }, // 32: "F"
+	{ 0x22, scan_code_names + 103, PRESSED, 'g', PS2_MODIFIER_NONE, 33 }, // 33: "G"
+	{ 0x23, scan_code_names + 105, PRESSED, 'h', PS2_MODIFIER_NONE, 34 }, // 34: "H"
+	{ 0x24, scan_code_names + 107, PRESSED, 'j', PS2_MODIFIER_NONE, 35 }, // 35: "J"
+	{ 0x25, scan_code_names + 109, PRESSED, 'k', PS2_MODIFIER_NONE, 36 }, // 36: "K"
+	{ 0x26, scan_code_names + 111, PRESSED, 'l', PS2_MODIFIER_NONE, 37 }, // 37: "L"
+	{ 0x27, scan_code_names + 113, PRESSED, ';', PS2_MODIFIER_NONE, 38 }, // 38: ";"
+	{ 0x28, scan_code_names + 115, PRESSED, '\'', PS2_MODIFIER_NONE, 39 }, // 39: "' (single quote)"
+	{ 0x29, scan_code_names + 132, PRESSED, '`', PS2_MODIFIER_NONE, 40 }, // 40: "` (back tick)"
+	{ 0x2a, scan_code_names + 146, PRESSED, 0x0, PS2_MODIFIER_LEFT_SHIFT, 41 }, // 41: "left shift"
+	{ 0x2b, scan_code_names + 157, PRESSED, '\\', PS2_MODIFIER_NONE, 42 }, // 42: "\\"
+	{ 0x2c, scan_code_names + 159, PRESSED, 'z', PS2_MODIFIER_NONE, 43 }, // 43: "Z"
+	{ 0x2d, scan_code_names + 161, PRESSED, 'x', PS2_MODIFIER_NONE, 44 }, // 44: "X"
+	{ 0x2e, scan_code_names + 163, PRESSED, 'c', PS2_MODIFIER_NONE, 45 }, // 45: "C"
+	{ 0x2f, scan_code_names + 165, PRESSED, 'v', PS2_MODIFIER_NONE, 46 }, // 46: "V"
+	{ 0x30, scan_code_names + 167, PRESSED, 'b', PS2_MODIFIER_NONE, 47 }, // 47: "B"
+	{ 0x31, scan_code_names + 169, PRESSED, 'n', PS2_MODIFIER_NONE, 48 }, // 48: "N"
+	{ 0x32, scan_code_names + 171, PRESSED, 'm', PS2_MODIFIER_NONE, 49 }, // 49: "M"
+	{ 0x33, scan_code_names + 173, PRESSED, ',', PS2_MODIFIER_NONE, 50 }, // 50: ","
+	{ 0x34, scan_code_names + 175, PRESSED, '.', PS2_MODIFIER_NONE, 51 }, // 51: "."
+	{ 0x35, scan_code_names + 177, PRESSED, '/', PS2_MODIFIER_NONE, 52 }, // 52: "/"
+	{ 0x36, scan_code_names + 179, PRESSED, 0x0, PS2_MODIFIER_RIGHT_SHIFT, 53 }, // 53: "right shift"
+	{ 0x37, scan_code_names + 191, PRESSED, '*', PS2_MODIFIER_NONE, 54 }, // 54: "(keypad) *"
+	{ 0x38, scan_code_names + 202, PRESSED, 0x0, PS2_MODIFIER_LEFT_ALT, 55 }, // 55: "left alt"
+	{ 0x39, scan_code_names + 211, PRESSED, ' ', PS2_MODIFIER_NONE, 56 }, // 56: "space"
+	{ 0x3a, scan_code_names + 217, PRESSED, 0x0, PS2_MODIFIER_CAPSLOCK, 57 }, // 57: "CapsLock"
+	{ 0x3b, scan_code_names + 226, PRESSED, 0x0, PS2_MODIFIER_NONE, 58 }, // 58: "F1"
+	{ 0x3c, scan_code_names + 229, PRESSED, 0x0, PS2_MODIFIER_NONE, 59 }, // 59: "F2"
+	{ 0x3d, scan_code_names + 232, PRESSED, 0x0, PS2_MODIFIER_NONE, 60 }, // 60: "F3"
+	{ 0x3e, scan_code_names + 235, PRESSED, 0x0, PS2_MODIFIER_NONE, 61 }, // 61: "F4"
+	{ 0x3f, scan_code_names + 238, PRESSED, 0x0, PS2_MODIFIER_NONE, 62 }, // 62: "F5"
+	{ 0x40, scan_code_names + 241, PRESSED, 0x0, PS2_MODIFIER_NONE, 63 }, // 63: "F6"
+	{ 0x41, scan_code_names + 244, PRESSED, 0x0, PS2_MODIFIER_NONE, 64 }, // 64: "F7"
+	{ 0x42, scan_code_names + 247, PRESSED, 0x0, PS2_MODIFIER_NONE, 65 }, // 65: "F8"
+	{ 0x43, scan_code_names + 250, PRESSED, 0x0, PS2_MODIFIER_NONE, 66 }, // 66: "F9"
+	{ 0x44, scan_code_names + 253, PRESSED, 0x0, PS2_MODIFIER_NONE, 67 }, // 67: "F10"
+	{ 0x45, scan_code_names + 257, PRESSED, 0x0, PS2_MODIFIER_NUMBER_LOCK, 68 }, // 68: "NumberLock"
+	{ 0x46, scan_code_names + 268, PRESSED, 0x0, PS2_MODIFIER_SCROLL_LOCK, 69 }, // 69: "ScrollLock"
+	{ 0x47, scan_code_names + 279, PRESSED, '7', PS2_MODIFIER_NONE, 70 }, // 70: "(keypad) 7"
+	{ 0x48, scan_code_names + 290, PRESSED, '8', PS2_MODIFIER_NONE, 71 }, // 71: "(keypad) 8"
+	{ 0x49, scan_code_names + 301, PRESSED, '9', PS2_MODIFIER_NONE, 72 }, // 72: "(keypad) 9"
+	{ 0x4a, scan_code_names + 312, PRESSED, '-', PS2_MODIFIER_NONE, 73 }, // 73: "(keypad) -"
+	{ 0x4b, scan_code_names + 323, PRESSED, '4', PS2_MODIFIER_NONE, 74 }, // 74: "(keypad) 4"
+	{ 0x4c, scan_code_names + 334, PRESSED, '5', PS2_MODIFIER_NONE, 75 }, // 75: "(keypad) 5"
+	{ 0x4d, scan_code_names + 345, PRESSED, '6', PS2_MODIFIER_NONE, 76 }, // 76: "(keypad) 6"
+	{ 0x4e, scan_code_names + 356, PRESSED, '+', PS2_MODIFIER_NONE, 77 }, // 77: "(keypad) +"
+	{ 0x4f, scan_code_names + 367, PRESSED, '1', PS2_MODIFIER_NONE, 78 }, // 78: "(keypad) 1"
+	{ 0x50, scan_code_names + 378, PRESSED, '2', PS2_MODIFIER_NONE, 79 }, // 79: "(keypad) 2"
+	{ 0x51, scan_code_names + 389, PRESSED, '3', PS2_MODIFIER_NONE, 80 }, // 80: "(keypad) 3"
+	{ 0x52, scan_code_names + 400, PRESSED, '0', PS2_MODIFIER_NONE, 81 }, // 81: "(keypad) 0"
+	{ 0x53, scan_code_names + 411, PRESSED, '.', PS2_MODIFIER_NONE, 82 }, // 82: "(keypad) ."
+	{ 0x57, scan_code_names + 422, PRESSED, 0x0, PS2_MODIFIER_NONE, 83 }, // 83: "F11"
+	{ 0x58, scan_code_names + 426, PRESSED, 0x0, PS2_MODIFIER_NONE, 84 }, // 84: "F12"
+	{ 0x81, scan_code_names + 0, RELEASED, 0x0, PS2_MODIFIER_ESCAPE, 0 }, // 85: "escape"
+	{ 0x82, scan_code_names + 7, RELEASED, '1', PS2_MODIFIER_NONE, 1 }, // 86: "1"
+	{ 0x83, scan_code_names + 9, RELEASED, '2', PS2_MODIFIER_NONE, 2 }, // 87: "2"
+	{ 0x84, scan_code_names + 11, RELEASED, '3', PS2_MODIFIER_NONE, 3 }, // 88: "3"
+	{ 0x85, scan_code_names + 13, RELEASED, '4', PS2_MODIFIER_NONE, 4 }, // 89: "4"
+	{ 0x86, scan_code_names + 15, RELEASED, '5', PS2_MODIFIER_NONE, 5 }, // 90: "5"
+	{ 0x87, scan_code_names + 17, RELEASED, '6', PS2_MODIFIER_NONE, 6 }, // 91: "6"
+	{ 0x88, scan_code_names + 19, RELEASED, '7', PS2_MODIFIER_NONE, 7 }, // 92: "7"
+	{ 0x89, scan_code_names + 21, RELEASED, '8', PS2_MODIFIER_NONE, 8 }, // 93: "8"
+	{ 0x8a, scan_code_names + 23, RELEASED, '9', PS2_MODIFIER_NONE, 9 }, // 94: "9"
+	{ 0x8b, scan_code_names + 25, RELEASED, '0', PS2_MODIFIER_NONE, 10 }, // 95: "0 (zero)"
+	{ 0x8c, scan_code_names + 34, RELEASED, '-', PS2_MODIFIER_NONE, 11 }, // 96: "-"
+	{ 0x8d, scan_code_names + 36, RELEASED, '=', PS2_MODIFIER_NONE, 12 }, // 97: "="
+	{ 0x8e, scan_code_names + 38, RELEASED, 0x0, PS2_MODIFIER_NONE, 13 }, // 98: "backspace"
+	{ 0x8f, scan_code_names + 48, RELEASED, '\t', PS2_MODIFIER_NONE, 14 }, // 99: "tab"
+	{ 0x90, scan_code_names + 52, RELEASED, 'q', PS2_MODIFIER_NONE, 15 }, // 100: "Q"
+	{ 0x91, scan_code_names + 54, RELEASED, 'w', PS2_MODIFIER_NONE, 16 }, // 101: "W"
+	{ 0x92, scan_code_names + 56, RELEASED, 'e', PS2_MODIFIER_NONE, 17 }, // 102: "E"
+	{ 0x93, scan_code_names + 58, RELEASED, 'r', PS2_MODIFIER_NONE, 18 }, // 103: "R"
+	{ 0x94, scan_code_names + 60, RELEASED, 't', PS2_MODIFIER_NONE, 19 }, // 104: "T"
+	{ 0x95, scan_code_names + 62, RELEASED, 'y', PS2_MODIFIER_NONE, 20 }, // 105: "Y"
+	{ 0x96, scan_code_names + 64, RELEASED, 'u', PS2_MODIFIER_NONE, 21 }, // 106: "U"
+	{ 0x97, scan_code_names + 66, RELEASED, 'i', PS2_MODIFIER_NONE, 22 }, // 107: "I"
+	{ 0x98, scan_code_names + 68, RELEASED, 'o', PS2_MODIFIER_NONE, 23 }, // 108: "O"
+	{ 0x99, scan_code_names + 70, RELEASED, 'p', PS2_MODIFIER_NONE, 24 }, // 109: "P"
+	{ 0x9a, scan_code_names + 72, RELEASED, '[', PS2_MODIFIER_NONE, 25 }, // 110: "["
+	{ 0x9b, scan_code_names + 74, RELEASED, ']', PS2_MODIFIER_NONE, 26 }, // 111: "]"
+	{ 0x9c, scan_code_names + 76, RELEASED, '\n', PS2_MODIFIER_NONE, 27 }, // 112: "enter"
+	{ 0x9d, scan_code_names + 82, RELEASED, 0x0, PS2_MODIFIER_LEFT_CONTROL, 28 }, // 113: "left control"
+	{ 0x9e, scan_code_names + 95, RELEASED, 'a', PS2_MODIFIER_NONE, 29 }, // 114: "A"
+	{ 0x9f, scan_code_names + 97, RELEASED, 's', PS2_MODIFIER_NONE, 30 }, // 115: "S"
+	{ 0xa0, scan_code_names + 99, RELEASED, 'd', PS2_MODIFIER_NONE, 31 }, // 116: "D"
+	{ 0xa1, scan_code_names + 101, RELEASED, 'f', PS2_MODIFIER_NONE, 32 }, // 117: "F"
+	{ 0xa2, scan_code_names + 103, RELEASED, 'g', PS2_MODIFIER_NONE, 33 }, // 118: "G"
+	{ 0xa3, scan_code_names + 105, RELEASED, 'h', PS2_MODIFIER_NONE, 34 }, // 119: "H"
+	{ 0xa4, scan_code_names + 107, RELEASED, 'j', PS2_MODIFIER_NONE, 35 }, // 120: "J"
+	{ 0xa5, scan_code_names + 109, RELEASED, 'k', PS2_MODIFIER_NONE, 36 }, // 121: "K"
+	{ 0xa6, scan_code_names + 111, RELEASED, 'l', PS2_MODIFIER_NONE, 37 }, // 122: "L"
+	{ 0xa7, scan_code_names + 113, RELEASED, ';', PS2_MODIFIER_NONE, 38 }, // 123: ";"
+	{ 0xa8, scan_code_names + 115, RELEASED, '\'', PS2_MODIFIER_NONE, 39 }, // 124: "' (single quote)"
+	{ 0xa9, scan_code_names + 132, RELEASED, '`', PS2_MODIFIER_NONE, 40 }, // 125: "` (back tick)"
+	{ 0xaa, scan_code_names + 146, RELEASED, 0x0, PS2_MODIFIER_LEFT_SHIFT, 41 }, // 126: "left shift"
+	{ 0xab, scan_code_names + 157, RELEASED, '\\', PS2_MODIFIER_NONE, 42 }, // 127: "\\"
+	{ 0xac, scan_code_names + 159, RELEASED, 'z', PS2_MODIFIER_NONE, 43 }, // 128: "Z"
+	{ 0xad, scan_code_names + 161, RELEASED, 'x', PS2_MODIFIER_NONE, 44 }, // 129: "X"
+	{ 0xae, scan_code_names + 163, RELEASED, 'c', PS2_MODIFIER_NONE, 45 }, // 130: "C"
+	{ 0xaf, scan_code_names + 165, RELEASED, 'v', PS2_MODIFIER_NONE, 46 }, // 131: "V"
+	{ 0xb0, scan_code_names + 167, RELEASED, 'b', PS2_MODIFIER_NONE, 47 }, // 132: "B"
+	{ 0xb1, scan_code_names + 169, RELEASED, 'n', PS2_MODIFIER_NONE, 48 }, // 133: "N"
+	{ 0xb2, scan_code_names + 171, RELEASED, 'm', PS2_MODIFIER_NONE, 49 }, // 134: "M"
+	{ 0xb3, scan_code_names + 173, RELEASED, ',', PS2_MODIFIER_NONE, 50 }, // 135: ","
+	{ 0xb4, scan_code_names + 175, RELEASED, '.', PS2_MODIFIER_NONE, 51 }, // 136: "."
+	{ 0xb5, scan_code_names + 177, RELEASED, '/', PS2_MODIFIER_NONE, 52 }, // 137: "/"
+	{ 0xb6, scan_code_names + 179, RELEASED, 0x0, PS2_MODIFIER_RIGHT_SHIFT, 53 }, // 138: "right shift"
+	{ 0xb7, scan_code_names + 191, RELEASED, '*', PS2_MODIFIER_NONE, 54 }, // 139: "(keypad) *"
+	{ 0xb8, scan_code_names + 202, RELEASED, 0x0, PS2_MODIFIER_LEFT_ALT, 55 }, // 140: "left alt"
+	{ 0xb9, scan_code_names + 211, RELEASED, ' ', PS2_MODIFIER_NONE, 56 }, // 141: "space"
+	{ 0xba, scan_code_names + 217, RELEASED, 0x0, PS2_MODIFIER_CAPSLOCK, 57 }, // 142: "CapsLock"
+	{ 0xbb, scan_code_names + 226, RELEASED, 0x0, PS2_MODIFIER_NONE, 58 }, // 143: "F1"
+	{ 0xbc, scan_code_names + 229, RELEASED, 0x0, PS2_MODIFIER_NONE, 59 }, // 144: "F2"
+	{ 0xbd, scan_code_names + 232, RELEASED, 0x0, PS2_MODIFIER_NONE, 60 }, // 145: "F3"
+	{ 0xbe, scan_code_names + 235, RELEASED, 0x0, PS2_MODIFIER_NONE, 61 }, // 146: "F4"
+	{ 0xbf, scan_code_names + 238, RELEASED, 0x0, PS2_MODIFIER_NONE, 62 }, // 147: "F5"
+	{ 0xc0, scan_code_names + 241, RELEASED, 0x0, PS2_MODIFIER_NONE, 63 }, // 148: "F6"
+	{ 0xc1, scan_code_names + 244, RELEASED, 0x0, PS2_MODIFIER_NONE, 64 }, // 149: "F7"
+	{ 0xc2, scan_code_names + 247, RELEASED, 0x0, PS2_MODIFIER_NONE, 65 }, // 150: "F8"
+	{ 0xc3, scan_code_names + 250, RELEASED, 0x0, PS2_MODIFIER_NONE, 66 }, // 151: "F9"
+	{ 0xc4, scan_code_names + 253, RELEASED, 0x0, PS2_MODIFIER_NONE, 67 }, // 152: "F10"
+	{ 0xc5, scan_code_names + 257, RELEASED, 0x0, PS2_MODIFIER_NUMBER_LOCK, 68 }, // 153: "NumberLock"
+	{ 0xc6, scan_code_names + 268, RELEASED, 0x0, PS2_MODIFIER_SCROLL_LOCK, 69 }, // 154: "ScrollLock"
+	{ 0xc7, scan_code_names + 279, RELEASED, '7', PS2_MODIFIER_NONE, 70 }, // 155: "(keypad) 7"
+	{ 0xc8, scan_code_names + 290, RELEASED, '8', PS2_MODIFIER_NONE, 71 }, // 156: "(keypad) 8"
+	{ 0xc9, scan_code_names + 301, RELEASED, '9', PS2_MODIFIER_NONE, 72 }, // 157: "(keypad) 9"
+	{ 0xca, scan_code_names + 312, RELEASED, '-', PS2_MODIFIER_NONE, 73 }, // 158: "(keypad) -"
+	{ 0xcb, scan_code_names + 323, RELEASED, '4', PS2_MODIFIER_NONE, 74 }, // 159: "(keypad) 4"
+	{ 0xcc, scan_code_names + 334, RELEASED, '5', PS2_MODIFIER_NONE, 75 }, // 160: "(keypad) 5"
+	{ 0xcd, scan_code_names + 345, RELEASED, '6', PS2_MODIFIER_NONE, 76 }, // 161: "(keypad) 6"
+	{ 0xce, scan_code_names + 356, RELEASED, '+', PS2_MODIFIER_NONE, 77 }, // 162: "(keypad) +"
+	{ 0xcf, scan_code_names + 367, RELEASED, '1', PS2_MODIFIER_NONE, 78 }, // 163: "(keypad) 1"
+	{ 0xd0, scan_code_names + 378, RELEASED, '2', PS2_MODIFIER_NONE, 79 }, // 164: "(keypad) 2"
+	{ 0xd1, scan_code_names + 389, RELEASED, '3', PS2_MODIFIER_NONE, 80 }, // 165: "(keypad) 3"
+	{ 0xd2, scan_code_names + 400, RELEASED, '0', PS2_MODIFIER_NONE, 81 }, // 166: "(keypad) 0"
+	{ 0xd3, scan_code_names + 411, RELEASED, '.', PS2_MODIFIER_NONE, 82 }, // 167: "(keypad) ."
+	{ 0xd7, scan_code_names + 422, RELEASED, 0x0, PS2_MODIFIER_NONE, 83 }, // 168: "F11"
+	{ 0xd8, scan_code_names + 426, RELEASED, 0x0, PS2_MODIFIER_NONE, 84 }, // 169: "F12"
+	{ 0xe010, scan_code_names + 430, PRESSED, 0x0, PS2_MODIFIER_NONE, 85 }, // 170: "(multimedia) previous track"
+	{ 0xe019, scan_code_names + 458, PRESSED, 0x0, PS2_MODIFIER_NONE, 86 }, // 171: "(multimedia) next track"
+	{ 0xe01c, scan_code_names + 482, PRESSED, '\n', PS2_MODIFIER_NONE, 87 }, // 172: "(keypad) enter"
+	{ 0xe01d, scan_code_names + 497, PRESSED, 0x0, PS2_MODIFIER_RIGHT_CONTROL, 88 }, // 173: "right control"
+	{ 0xe020, scan_code_names + 511, PRESSED, 0x0, PS2_MODIFIER_NONE, 89 }, // 174: "(multimedia) mute"
+	{ 0xe021, scan_code_names + 529, PRESSED, 0x0, PS2_MODIFIER_NONE, 90 }, // 175: "(multimedia) calculator"
+	{ 0xe022, scan_code_names + 553, PRESSED, 0x0, PS2_MODIFIER_NONE, 91 }, // 176: "(multimedia) play"
+	{ 0xe024, scan_code_names + 571, PRESSED, 0x0, PS2_MODIFIER_NONE, 92 }, // 177: "(multimedia) stop"
+	{ 0xe02e, scan_code_names + 589, PRESSED, 0x0, PS2_MODIFIER_NONE, 93 }, // 178: "(multimedia) volume down"
+	{ 0xe030, scan_code_names + 614, PRESSED, 0x0, PS2_MODIFIER_NONE, 94 }, // 179: "(multimedia) volume up"
+	{ 0xe032, scan_code_names + 637, PRESSED, 0x0, PS2_MODIFIER_NONE, 95 }, // 180: "(multimedia) WWW home"
+	{ 0xe035, scan_code_names + 659, PRESSED, '/', PS2_MODIFIER_NONE, 96 }, // 181: "(keypad) /"
+	{ 0xe038, scan_code_names + 670, PRESSED, 0x0, PS2_MODIFIER_RIGHT_ALT, 97 }, // 182: "right alt (or altGr)"
+	{ 0xe047, scan_code_names + 691, PRESSED, 0x0, PS2_MODIFIER_NONE, 98 }, // 183: "home"
+	{ 0xe048, scan_code_names + 696, PRESSED, 0x0, PS2_MODIFIER_NONE, 99 }, // 184: "cursor up"
+	{ 0xe049, scan_code_names + 706, PRESSED, 0x0, PS2_MODIFIER_NONE, 100 }, // 185: "page up"
+	{ 0xe04b, scan_code_names + 714, PRESSED, 0x0, PS2_MODIFIER_NONE, 101 }, // 186: "cursor left"
+	{ 0xe04d, scan_code_names + 726, PRESSED, 0x0, PS2_MODIFIER_NONE, 102 }, // 187: "cursor right"
+	{ 0xe04f, scan_code_names + 739, PRESSED, 0x0, PS2_MODIFIER_NONE, 103 }, // 188: "end"
+	{ 0xe050, scan_code_names + 743, PRESSED, 0x0, PS2_MODIFIER_NONE, 104 }, // 189: "cursor down"
+	{ 0xe051, scan_code_names + 755, PRESSED, 0x0, PS2_MODIFIER_NONE, 105 }, // 190: "page down"
+	{ 0xe052, scan_code_names + 765, PRESSED, 0x0, PS2_MODIFIER_NONE, 106 }, // 191: "insert"
+	{ 0xe053, scan_code_names + 772, PRESSED, 0x0, PS2_MODIFIER_NONE, 107 }, // 192: "delete"
+	{ 0xe05b, scan_code_names + 779, PRESSED, 0x0, PS2_MODIFIER_NONE, 108 }, // 193: "left GUI"
+	{ 0xe05c, scan_code_names + 788, PRESSED, 0x0, PS2_MODIFIER_NONE, 109 }, // 194: "right GUI"
+	{ 0xe05d, scan_code_names + 798, PRESSED, 0x0, PS2_MODIFIER_NONE, 110 }, // 195: "\"apps\""
+	{ 0xe05e, scan_code_names + 805, PRESSED, 0x0, PS2_MODIFIER_NONE, 111 }, // 196: "(ACPI) power"
+	{ 0xe05f, scan_code_names + 818, PRESSED, 0x0, PS2_MODIFIER_NONE, 112 }, // 197: "(ACPI) sleep"
+	{ 0xe063, scan_code_names + 831, PRESSED, 0x0, PS2_MODIFIER_NONE, 113 }, // 198: "(ACPI) wake"
+	{ 0xe065, scan_code_names + 843, PRESSED, 0x0, PS2_MODIFIER_NONE, 114 }, // 199: "(multimedia) WWW search"
+	{ 0xe066, scan_code_names + 867, PRESSED, 0x0, PS2_MODIFIER_NONE, 115 }, // 200: "(multimedia) WWW favorites"
+	{ 0xe067, scan_code_names + 894, PRESSED, 0x0, PS2_MODIFIER_NONE, 116 }, // 201: "(multimedia) WWW refresh"
+	{ 0xe068, scan_code_names + 919, PRESSED, 0x0, PS2_MODIFIER_NONE, 117 }, // 202: "(multimedia) WWW stop"
+	{ 0xe069, scan_code_names + 941, PRESSED, 0x0, PS2_MODIFIER_NONE, 118 }, // 203: "(multimedia) WWW forward"
+	{ 0xe06a, scan_code_names + 966, PRESSED, 0x0, PS2_MODIFIER_NONE, 119 }, // 204: "(multimedia) WWW back"
+	{ 0xe06b, scan_code_names + 988, PRESSED, 0x0, PS2_MODIFIER_NONE, 120 }, // 205: "(multimedia) my computer"
+	{ 0xe06c, scan_code_names + 1013, PRESSED, 0x0, PS2_MODIFIER_NONE, 121 }, // 206: "(multimedia) email"
+	{ 0xe06d, scan_code_names + 1032, PRESSED, 0x0, PS2_MODIFIER_NONE, 122 }, // 207: "(multimedia) media select"
+	{ 0xe090, scan_code_names + 430, RELEASED, 0x0, PS2_MODIFIER_NONE, 85 }, // 208: "(multimedia) previous track"
+	{ 0xe099, scan_code_names + 458, RELEASED, 0x0, PS2_MODIFIER_NONE, 86 }, // 209: "(multimedia) next track"
+	{ 0xe09c, scan_code_names + 482, RELEASED, '\n', PS2_MODIFIER_NONE, 87 }, // 210: "(keypad) enter"
+	{ 0xe09d, scan_code_names + 497, RELEASED, 0x0, PS2_MODIFIER_RIGHT_CONTROL, 88 }, // 211: "right control"
+	{ 0xe0a0, scan_code_names + 511, RELEASED, 0x0, PS2_MODIFIER_NONE, 89 }, // 212: "(multimedia) mute"
+	{ 0xe0a1, scan_code_names + 529, RELEASED, 0x0, PS2_MODIFIER_NONE, 90 }, // 213: "(multimedia) calculator"
+	{ 0xe0a2, scan_code_names + 553, RELEASED, 0x0, PS2_MODIFIER_NONE, 91 }, // 214: "(multimedia) play"
+	{ 0xe0a4, scan_code_names + 571, RELEASED, 0x0, PS2_MODIFIER_NONE, 92 }, // 215: "(multimedia) stop"
+	{ 0xe0ae, scan_code_names + 589, RELEASED, 0x0, PS2_MODIFIER_NONE, 93 }, // 216: "(multimedia) volume down"
+	{ 0xe0b0, scan_code_names + 614, RELEASED, 0x0, PS2_MODIFIER_NONE, 94 }, // 217: "(multimedia) volume up"
+	{ 0xe0b2, scan_code_names + 637, RELEASED, 0x0, PS2_MODIFIER_NONE, 95 }, // 218: "(multimedia) WWW home"
+	{ 0xe0b5, scan_code_names + 659, RELEASED, '/', PS2_MODIFIER_NONE, 96 }, // 219: "(keypad) /"
+	{ 0xe0b8, scan_code_names + 670, RELEASED, 0x0, PS2_MODIFIER_RIGHT_ALT, 97 }, // 220: "right alt (or altGr)"
+	{ 0xe0c7, scan_code_names + 691, RELEASED, 0x0, PS2_MODIFIER_NONE, 98 }, // 221: "home"
+	{ 0xe0c8, scan_code_names + 696, RELEASED, 0x0, PS2_MODIFIER_NONE, 99 }, // 222: "cursor up"
+	{ 0xe0c9, scan_code_names + 706, RELEASED, 0x0, PS2_MODIFIER_NONE, 100 }, // 223: "page up"
+	{ 0xe0cb, scan_code_names + 714, RELEASED, 0x0, PS2_MODIFIER_NONE, 101 }, // 224: "cursor left"
+	{ 0xe0cd, scan_code_names + 726, RELEASED, 0x0, PS2_MODIFIER_NONE, 102 }, // 225: "cursor right"
+	{ 0xe0cf, scan_code_names + 739, RELEASED, 0x0, PS2_MODIFIER_NONE, 103 }, // 226: "end"
+	{ 0xe0d0, scan_code_names + 743, RELEASED, 0x0, PS2_MODIFIER_NONE, 104 }, // 227: "cursor down"
+	{ 0xe0d1, scan_code_names + 755, RELEASED, 0x0, PS2_MODIFIER_NONE, 105 }, // 228: "page down"
+	{ 0xe0d2, scan_code_names + 765, RELEASED, 0x0, PS2_MODIFIER_NONE, 106 }, // 229: "insert"
+	{ 0xe0d3, scan_code_names + 772, RELEASED, 0x0, PS2_MODIFIER_NONE, 107 }, // 230: "delete"
+	{ 0xe0db, scan_code_names + 779, RELEASED, 0x0, PS2_MODIFIER_NONE, 108 }, // 231: "left GUI"
+	{ 0xe0dc, scan_code_names + 788, RELEASED, 0x0, PS2_MODIFIER_NONE, 109 }, // 232: "right GUI"
+	{ 0xe0dd, scan_code_names + 798, RELEASED, 0x0, PS2_MODIFIER_NONE, 110 }, // 233: "\"apps\""
+	{ 0xe0de, scan_code_names + 805, RELEASED, 0x0, PS2_MODIFIER_NONE, 111 }, // 234: "(ACPI) power"
+	{ 0xe0df, scan_code_names + 818, RELEASED, 0x0, PS2_MODIFIER_NONE, 112 }, // 235: "(ACPI) sleep"
+	{ 0xe0e3, scan_code_names + 831, RELEASED, 0x0, PS2_MODIFIER_NONE, 113 }, // 236: "(ACPI) wake"
+	{ 0xe0e5, scan_code_names + 843, RELEASED, 0x0, PS2_MODIFIER_NONE, 114 }, // 237: "(multimedia) WWW search"
+	{ 0xe0e6, scan_code_names + 867, RELEASED, 0x0, PS2_MODIFIER_NONE, 115 }, // 238: "(multimedia) WWW favorites"
+	{ 0xe0e7, scan_code_names + 894, RELEASED, 0x0, PS2_MODIFIER_NONE, 116 }, // 239: "(multimedia) WWW refresh"
+	{ 0xe0e8, scan_code_names + 919, RELEASED, 0x0, PS2_MODIFIER_NONE, 117 }, // 240: "(multimedia) WWW stop"
+	{ 0xe0e9, scan_code_names + 941, RELEASED, 0x0, PS2_MODIFIER_NONE, 118 }, // 241: "(multimedia) WWW forward"
+	{ 0xe0ea, scan_code_names + 966, RELEASED, 0x0, PS2_MODIFIER_NONE, 119 }, // 242: "(multimedia) WWW back"
+	{ 0xe0eb, scan_code_names + 988, RELEASED, 0x0, PS2_MODIFIER_NONE, 120 }, // 243: "(multimedia) my computer"
+	{ 0xe0ec, scan_code_names + 1013, RELEASED, 0x0, PS2_MODIFIER_NONE, 121 }, // 244: "(multimedia) email"
+	{ 0xe0ed, scan_code_names + 1032, RELEASED, 0x0, PS2_MODIFIER_NONE, 122 }, // 245: "(multimedia) media select"
+	{ 0xe02ae037, scan_code_names + 1058, PRESSED, 0x0, PS2_MODIFIER_NONE, 123 }, // 246: "print screen"
+	{ 0xe0b7e0aa, scan_code_names + 1058, RELEASED, 0x0, PS2_MODIFIER_NONE, 123 }, // 247: "print screen"
+	{ 0xe11d45e19dc5, scan_code_names + 1071, PRESSED, 0x0, PS2_MODIFIER_NONE, 124 }, // 248: "pause"
+};
+
+static const struct scan_code_index	scan_code_set_1_index = {
+	.single = {
+		[0x1] = &scan_code_set_1_keys[0], // 0x1
+		[0x2] = &scan_code_set_1_keys[1], // 0x2
+		[0x3] = &scan_code_set_1_keys[2], // 0x3
+		[0x4] = &scan_code_set_1_keys[3], // 0x4
+		[0x5] = &scan_code_set_1_keys[4], // 0x5
+		[0x6] = &scan_code_set_1_keys[5], // 0x6
+		[0x7] = &scan_code_set_1_keys[6], // 0x7
+		[0x8] = &scan_code_set_1_keys[7], // 0x8
+		[0x9] = &scan_code_set_1_keys[8], // 0x9
+		[0xa] = &scan_code_set_1_keys[9], // 0xa
+		[0xb] = &scan_code_set_1_keys[10], // 0xb
+		[0xc] = &scan_code_set_1_keys[11], // 0xc
+		[0xd] = &scan_code_set_1_keys[12], // 0xd
+		[0xe] = &scan_code_set_1_keys[13], // 0xe
+		[0xf] = &scan_code_set_1_keys[14], // 0xf
+		[0x10] = &scan_code_set_1_keys[15], // 0x10
+		[0x11] = &scan_code_set_1_keys[16], // 0x11
+		[0x12] = &scan_code_set_1_keys[17], // 0x12
+		[0x13] = &scan_code_set_1_keys[18], // 0x13
+		[0x14] = &scan_code_set_1_keys[19], // 0x14
+		[0x15] = &scan_code_set_1_keys[20], // 0x15
+		[0x16] = &scan_code_set_1_keys[21], // 0x16
+		[0x17] = &scan_code_set_1_keys[22], // 0x17
+		[0x18] = &scan_code_set_1_keys[23], // 0x18
+		[0x19] = &scan_code_set_1_keys[24], // 0x19
+		[0x1a] = &scan_code_set_1_keys[25], // 0x1a
+		[0x1b] = &scan_code_set_1_keys[26], // 0x1b
+		[0x1c] = &scan_code_set_1_keys[27], // 0x1c
+		[0x1d] = &scan_code_set_1_keys[28], // 0x1d
+		[0x1e] = &scan_code_set_1_keys[29], // 0x1e
+		[0x1f] = &scan_code_set_1_keys[30], // 0x1f
+		[0x20] = &scan_code_set_1_keys[31], // 0x20
+		[0x21] = &scan_code_set_1_keys[32], // 0x21
+		[0x22] = &scan_code_set_1_keys[33], // 0x22
+		[0x23] = &scan_code_set_1_keys[34], // 0x23
+		[0x24] = &scan_code_set_1_keys[35], // 0x24
+		[0x25] = &scan_code_set_1_keys[36], // 0x25
+		[0x26] = &scan_code_set_1_keys[37], // 0x26
+		[0x27] = &scan_code_set_1_keys[38], // 0x27
+		[0x28] = &scan_code_set_1_keys[39], // 0x28
+		[0x29] = &scan_code_set_1_keys[40], // 0x29
+		[0x2a] = &scan_code_set_1_keys[41], // 0x2a
+		[0x2b] = &scan_code_set_1_keys[42], // 0x2b
+		[0x2c] = &scan_code_set_1_keys[43], // 0x2c
+		[0x2d] = &scan_code_set_1_keys[44], // 0x2d
+		[0x2e] = &scan_code_set_1_keys[45], // 0x2e
+		[0x2f] = &scan_code_set_1_keys[46], // 0x2f
+		[0x30] = &scan_code_set_1_keys[47], // 0x30
+		[0x31] = &scan_code_set_1_keys[48], // 0x31
+		[0x32] = &scan_code_set_1_keys[49], // 0x32
+		[0x33] = &scan_code_set_1_keys[50], // 0x33
+		[0x34] = &scan_code_set_1_keys[51], // 0x34
+		[0x35] = &scan_code_set_1_keys[52], // 0x35
+		[0x36] = &scan_code_set_1_keys[53], // 0x36
+		[0x37] = &scan_code_set_1_keys[54], // 0x37
+		[0x38] = &scan_code_set_1_keys[55], // 0x38
+		[0x39] = &scan_code_set_1_keys[56], // 0x39
+		[0x3a] = &scan_code_set_1_keys[57], // 0x3a
+		[0x3b] = &scan_code_set_1_keys[58], // 0x3b
+		[0x3c] = &scan_code_set_1_keys[59], // 0x3c
+		[0x3d] = &scan_code_set_1_keys[60], // 0x3d
+		[0x3e] = &scan_code_set_1_keys[61], // 0x3e
+		[0x3f] = &scan_code_set_1_keys[62], // 0x3f
+		[0x40] = &scan_code_set_1_keys[63], // 0x40
+		[0x41] = &scan_code_set_1_keys[64], // 0x41
+		[0x42] = &scan_code_set_1_keys[65], // 0x42
+		[0x43] = &scan_code_set_1_keys[66], // 0x43
+		[0x44] = &scan_code_set_1_keys[67], // 0x44
+		[0x45] = &scan_code_set_1_keys[68], // 0x45
+		[0x46] = &scan_code_set_1_keys[69], // 0x46
+		[0x47] = &scan_code_set_1_keys[70], // 0x47
+		[0x48] = &scan_code_set_1_keys[71], // 0x48
+		[0x49] = &scan_code_set_1_keys[72], // 0x49
+		[0x4a] = &scan_code_set_1_keys[73], // 0x4a
+		[0x4b] = &scan_code_set_1_keys[74], // 0x4b
+		[0x4c] = &scan_code_set_1_keys[75], // 0x4c
+		[0x4d] = &scan_code_set_1_keys[76], // 0x4d
+		[0x4e] = &scan_code_set_1_keys[77], // 0x4e
+		[0x4f] = &scan_code_set_1_keys[78], // 0x4f
+		[0x50] = &scan_code_set_1_keys[79], // 0x50
+		[0x51] = &scan_code_set_1_keys[80], // 0x51
+		[0x52] = &scan_code_set_1_keys[81], // 0x52
+		[0x53] = &scan_code_set_1_keys[82], // 0x53
+		[0x57] = &scan_code_set_1_keys[83], // 0x57
+		[0x58] = &scan_code_set_1_keys[84], // 0x58
+		[0x81] = &scan_code_set_1_keys[85], // 0x81
+		[0x82] = &scan_code_set_1_keys[86], // 0x82
+		[0x83] = &scan_code_set_1_keys[87], // 0x83
+		[0x84] = &scan_code_set_1_keys[88], // 0x84
+		[0x85] = &scan_code_set_1_keys[89], // 0x85
+		[0x86] = &scan_code_set_1_keys[90], // 0x86
+		[0x87] = &scan_code_set_1_keys[91], // 0x87
+		[0x88] = &scan_code_set_1_keys[92], // 0x88
+		[0x89] = &scan_code_set_1_keys[93], // 0x89
+		[0x8a] = &scan_code_set_1_keys[94], // 0x8a
+		[0x8b] = &scan_code_set_1_keys[95], // 0x8b
+		[0x8c] = &scan_code_set_1_keys[96], // 0x8c
+		[0x8d] = &scan_code_set_1_keys[97], // 0x8d
+		[0x8e] = &scan_code_set_1_keys[98], // 0x8e
+		[0x8f] = &scan_code_set_1_keys[99], // 0x8f
+		[0x90] = &scan_code_set_1_keys[100], // 0x90
+		[0x91] = &scan_code_set_1_keys[101], // 0x91
+		[0x92] = &scan_code_set_1_keys[102], // 0x92
+		[0x93] = &scan_code_set_1_keys[103], // 0x93
+		[0x94] = &scan_code_set_1_keys[104], // 0x94
+		[0x95] = &scan_code_set_1_keys[105], // 0x95
+		[0x96] = &scan_code_set_1_keys[106], // 0x96
+		[0x97] = &scan_code_set_1_keys[107], // 0x97
+		[0x98] = &scan_code_set_1_keys[108], // 0x98
+		[0x99] = &scan_code_set_1_keys[109], // 0x99
+		[0x9a] = &scan_code_set_1_keys[110], // 0x9a
+		[0x9b] = &scan_code_set_1_keys[111], // 0x9b
+		[0x9c] = &scan_code_set_1_keys[112], // 0x9c
+		[0x9d] = &scan_code_set_1_keys[113], // 0x9d
+		[0x9e] = &scan_code_set_1_keys[114], // 0x9e
+		[0x9f] = &scan_code_set_1_keys[115], // 0x9f
+		[0xa0] = &scan_code_set_1_keys[116], // 0xa0
+		[0xa1] = &scan_code_set_1_keys[117], // 0xa1
+		[0xa2] = &scan_code_set_1_keys[118], // 0xa2
+		[0xa3] = &scan_code_set_1_keys[119], // 0xa3
+		[0xa4] = &scan_code_set_1_keys[120], // 0xa4
+		[0xa5] = &scan_code_set_1_keys[121], // 0xa5
+		[0xa6] = &scan_code_set_1_keys[122], // 0xa6
+		[0xa7] = &scan_code_set_1_keys[123], // 0xa7
+		[0xa8] = &scan_code_set_1_keys[124], // 0xa8
+		[0xa9] = &scan_code_set_1_keys[125], // 0xa9
+		[0xaa] = &scan_code_set_1_keys[126], // 0xaa
+		[0xab] = &scan_code_set_1_keys[127], // 0xab
+		[0xac] = &scan_code_set_1_keys[128], // 0xac
+		[0xad] = &scan_code_set_1_keys[129], // 0xad
+		[0xae] = &scan_code_set_1_keys[130], // 0xae
+		[0xaf] = &scan_code_set_1_keys[131], // 0xaf
+		[0xb0] = &scan_code_set_1_keys[132], // 0xb0
+		[0xb1] = &scan_code_set_1_keys[133], // 0xb1
+		[0xb2] = &scan_code_set_1_keys[134], // 0xb2
+		[0xb3] = &scan_code_set_1_keys[135], // 0xb3
+		[0xb4] = &scan_code_set_1_keys[136], // 0xb4
+		[0xb5] = &scan_code_set_1_keys[137], // 0xb5
+		[0xb6] = &scan_code_set_1_keys[138], // 0xb6
+		[0xb7] = &scan_code_set_1_keys[139], // 0xb7
+		[0xb8] = &scan_code_set_1_keys[140], // 0xb8
+		[0xb9] = &scan_code_set_1_keys[141], // 0xb9
+		[0xba] = &scan_code_set_1_keys[142], // 0xba
+		[0xbb] = &scan_code_set_1_keys[143], // 0xbb
+		[0xbc] = &scan_code_set_1_keys[144], // 0xbc
+		[0xbd] = &scan_code_set_1_keys[145], // 0xbd
+		[0xbe] = &scan_code_set_1_keys[146], // 0xbe
+		[0xbf] = &scan_code_set_1_keys[147], // 0xbf
+		[0xc0] = &scan_code_set_1_keys[148], // 0xc0
+		[0xc1] = &scan_code_set_1_keys[149], // 0xc1
+		[0xc2] = &scan_code_set_1_keys[150], // 0xc2
+		[0xc3] = &scan_code_set_1_keys[151], // 0xc3
+		[0xc4] = &scan_code_set_1_keys[152], // 0xc4
+		[0xc5] = &scan_code_set_1_keys[153], // 0xc5
+		[0xc6] = &scan_code_set_1_keys[154], // 0xc6
+		[0xc7] = &scan_code_set_1_keys[155], // 0xc7
+		[0xc8] = &scan_code_set_1_keys[156], // 0xc8
+		[0xc9] = &scan_code_set_1_keys[157], // 0xc9
+		[0xca] = &scan_code_set_1_keys[158], // 0xca
+		[0xcb] = &scan_code_set_1_keys[159], // 0xcb
+		[0xcc] = &scan_code_set_1_keys[160], // 0xcc
+		[0xcd] = &scan_code_set_1_keys[161], // 0xcd
+		[0xce] = &scan_code_set_1_keys[162], // 0xce
+		[0xcf] = &scan_code_set_1_keys[163], // 0xcf
+		[0xd0] = &scan_code_set_1_keys[164], // 0xd0
+		[0xd1] = &scan_code_set_1_keys[165], // 0xd1
+		[0xd2] = &scan_code_set_1_keys[166], // 0xd2
+		[0xd3] = &scan_code_set_1_keys[167], // 0xd3
+		[0xd7] = &scan_code_set_1_keys[168], // 0xd7
+		[0xd8] = &scan_code_set_1_keys[169], // 0xd8
+	},
+	.extended = {
+		{
+		[0x10] = &scan_code_set_1_keys[170], // 0xe010
+		[0x19] = &scan_code_set_1_keys[171], // 0xe019
+		[0x1c] = &scan_code_set_1_keys[172], // 0xe01c
+		[0x1d] = &scan_code_set_1_keys[173], // 0xe01d
+		[0x20] = &scan_code_set_1_keys[174], // 0xe020
+		[0x21] = &scan_code_set_1_keys[175], // 0xe021
+		[0x22] = &scan_code_set_1_keys[176], // 0xe022
+		[0x24] = &scan_code_set_1_keys[177], // 0xe024
+		[0x2e] = &scan_code_set_1_keys[178], // 0xe02e
+		[0x30] = &scan_code_set_1_keys[179], // 0xe030
+		[0x32] = &scan_code_set_1_keys[180], // 0xe032
+		[0x35] = &scan_code_set_1_keys[181], // 0xe035
+		[0x38] = &scan_code_set_1_keys[182], // 0xe038
+		[0x47] = &scan_code_set_1_keys[183], // 0xe047
+		[0x48] = &scan_code_set_1_keys[184], // 0xe048
+		[0x49] = &scan_code_set_1_keys[185], // 0xe049
+		[0x4b] = &scan_code_set_1_keys[186], // 0xe04b
+		[0x4d] = &scan_code_set_1_keys[187], // 0xe04d
+		[0x4f] = &scan_code_set_1_keys[188], // 0xe04f
+		[0x50] = &scan_code_set_1_keys[189], // 0xe050
+		[0x51] = &scan_code_set_1_keys[190], // 0xe051
+		[0x52] = &scan_code_set_1_keys[191], // 0xe052
+		[0x53] = &scan_code_set_1_keys[192], // 0xe053
+		[0x5b] = &scan_code_set_1_keys[193], // 0xe05b
+		[0x5c] = &scan_code_set_1_keys[194], // 0xe05c
+		[0x5d] = &scan_code_set_1_keys[195], // 0xe05d
+		[0x5e] = &scan_code_set_1_keys[196], // 0xe05e
+		[0x5f] = &scan_code_set_1_keys[197], // 0xe05f
+		[0x63] = &scan_code_set_1_keys[198], // 0xe063
+		[0x65] = &scan_code_set_1_keys[199], // 0xe065
+		[0x66] = &scan_code_set_1_keys[200], // 0xe066
+		[0x67] = &scan_code_set_1_keys[201], // 0xe067
+		[0x68] = &scan_code_set_1_keys[202], // 0xe068
+		[0x69] = &scan_code_set_1_keys[203], // 0xe069
+		[0x6a] = &scan_code_set_1_keys[204], // 0xe06a
+		[0x6b] = &scan_code_set_1_keys[205], // 0xe06b
+		[0x6c] = &scan_code_set_1_keys[206], // 0xe06c
+		[0x6d] = &scan_code_set_1_keys[207], // 0xe06d
+		[0x90] = &scan_code_set_1_keys[208], // 0xe090
+		[0x99] = &scan_code_set_1_keys[209], // 0xe099
+		[0x9c] = &scan_code_set_1_keys[210], // 0xe09c
+		[0x9d] = &scan_code_set_1_keys[211], // 0xe09d
+		[0xa0] = &scan_code_set_1_keys[212], // 0xe0a0
+		[0xa1] = &scan_code_set_1_keys[213], // 0xe0a1
+		[0xa2] = &scan_code_set_1_keys[214], // 0xe0a2
+		[0xa4] = &scan_code_set_1_keys[215], // 0xe0a4
+		[0xae] = &scan_code_set_1_keys[216], // 0xe0ae
+		[0xb0] = &scan_code_set_1_keys[217], // 0xe0b0
+		[0xb2] = &scan_code_set_1_keys[218], // 0xe0b2
+		[0xb5] = &scan_code_set_1_keys[219], // 0xe0b5
+		[0xb8] = &scan_code_set_1_keys[220], // 0xe0b8
+		[0xc7] = &scan_code_set_1_keys[221], // 0xe0c7
+		[0xc8] = &scan_code_set_1_keys[222], // 0xe0c8
+		[0xc9] = &scan_code_set_1_keys[223], // 0xe0c9
+		[0xcb] = &scan_code_set_1_keys[224], // 0xe0cb
+		[0xcd] = &scan_code_set_1_keys[225], // 0xe0cd
+		[0xcf] = &scan_code_set_1_keys[226], // 0xe0cf
+		[0xd0] = &scan_code_set_1_keys[227], // 0xe0d0
+		[0xd1] = &scan_code_set_1_keys[228], // 0xe0d1
+		[0xd2] = &scan_code_set_1_keys[229], // 0xe0d2
+		[0xd3] = &scan_code_set_1_keys[230], // 0xe0d3
+		[0xdb] = &scan_code_set_1_keys[231], // 0xe0db
+		[0xdc] = &scan_code_set_1_keys[232], // 0xe0dc
+		[0xdd] = &scan_code_set_1_keys[233], // 0xe0dd
+		[0xde] = &scan_code_set_1_keys[234], // 0xe0de
+		[0xdf] = &scan_code_set_1_keys[235], // 0xe0df
+		[0xe3] = &scan_code_set_1_keys[236], // 0xe0e3
+		[0xe5] = &scan_code_set_1_keys[237], // 0xe0e5
+		[0xe6] = &scan_code_set_1_keys[238], // 0xe0e6
+		[0xe7] = &scan_code_set_1_keys[239], // 0xe0e7
+		[0xe8] = &scan_code_set_1_keys[240], // 0xe0e8
+		[0xe9] = &scan_code_set_1_keys[241], // 0xe0e9
+		[0xea] = &scan_code_set_1_keys[242], // 0xe0ea
+		[0xeb] = &scan_code_set_1_keys[243], // 0xe0eb
+		[0xec] = &scan_code_set_1_keys[244], // 0xe0ec
+		[0xed] = &scan_code_set_1_keys[245], // 0xe0ed
+		},
+		{
+		},
+	},
+	.long_codes = {
+		&scan_code_set_1_keys[246], // 0xe02ae037
+		&scan_code_set_1_keys[247], // 0xe0b7e0aa
+		&scan_code_set_1_keys[248], // 0xe11d45e19dc5
+	},
+	.long_codes_len = 3,
+};
+
+static const struct scan_code_automaton	scan_code_set_1_automaton = {
+	.transitions = {
+		[0] = {
+			[0x1] = SCAN_CODE_TRANSITION_ACCEPT | 0,
+			[0x2] = SCAN_CODE_TRANSITION_ACCEPT | 1,
+			[0x3] = SCAN_CODE_TRANSITION_ACCEPT | 2,
+			[0x4] = SCAN_CODE_TRANSITION_ACCEPT | 3,
+			[0x5] = SCAN_CODE_TRANSITION_ACCEPT | 4,
+			[0x6] = SCAN_CODE_TRANSITION_ACCEPT | 5,
+			[0x7] = SCAN_CODE_TRANSITION_ACCEPT | 6,
+			[0x8] = SCAN_CODE_TRANSITION_ACCEPT | 7,
+			[0x9] = SCAN_CODE_TRANSITION_ACCEPT | 8,
+			[0xa] = SCAN_CODE_TRANSITION_ACCEPT | 9,
+			[0xb] = SCAN_CODE_TRANSITION_ACCEPT | 10,
+			[0xc] = SCAN_CODE_TRANSITION_ACCEPT | 11,
+			[0xd] = SCAN_CODE_TRANSITION_ACCEPT | 12,
+			[0xe] = SCAN_CODE_TRANSITION_ACCEPT | 13,
+			[0xf] = SCAN_CODE_TRANSITION_ACCEPT | 14,
+			[0x10] = SCAN_CODE_TRANSITION_ACCEPT | 15,
+			[0x11] = SCAN_CODE_TRANSITION_ACCEPT | 16,
+			[0x12] = SCAN_CODE_TRANSITION_ACCEPT | 17,
+			[0x13] = SCAN_CODE_TRANSITION_ACCEPT | 18,
+			[0x14] = SCAN_CODE_TRANSITION_ACCEPT | 19,
+			[0x15] = SCAN_CODE_TRANSITION_ACCEPT | 20,
+			[0x16] = SCAN_CODE_TRANSITION_ACCEPT | 21,
+			[0x17] = SCAN_CODE_TRANSITION_ACCEPT | 22,
+			[0x18] = SCAN_CODE_TRANSITION_ACCEPT | 23,
+			[0x19] = SCAN_CODE_TRANSITION_ACCEPT | 24,
+			[0x1a] = SCAN_CODE_TRANSITION_ACCEPT | 25,
+			[0x1b] = SCAN_CODE_TRANSITION_ACCEPT | 26,
+			[0x1c] = SCAN_CODE_TRANSITION_ACCEPT | 27,
+			[0x1d] = SCAN_CODE_TRANSITION_ACCEPT | 28,
+			[0x1e] = SCAN_CODE_TRANSITION_ACCEPT | 29,
+			[0x1f] = SCAN_CODE_TRANSITION_ACCEPT | 30,
+			[0x20] = SCAN_CODE_TRANSITION_ACCEPT | 31,
+			[0x21] = SCAN_CODE_TRANSITION_ACCEPT | 32,
+			[0x22] = SCAN_CODE_TRANSITION_ACCEPT | 33,
+			[0x23] = SCAN_CODE_TRANSITION_ACCEPT | 34,
+			[0x24] = SCAN_CODE_TRANSITION_ACCEPT | 35,
+			[0x25] = SCAN_CODE_TRANSITION_ACCEPT | 36,
+			[0x26] = SCAN_CODE_TRANSITION_ACCEPT | 37,
+			[0x27] = SCAN_CODE_TRANSITION_ACCEPT | 38,
+			[0x28] = SCAN_CODE_TRANSITION_ACCEPT | 39,
+			[0x29] = SCAN_CODE_TRANSITION_ACCEPT | 40,
+			[0x2a] = SCAN_CODE_TRANSITION_ACCEPT | 41,
+			[0x2b] = SCAN_CODE_TRANSITION_ACCEPT | 42,
+			[0x2c] = SCAN_CODE_TRANSITION_ACCEPT | 43,
+			[0x2d] = SCAN_CODE_TRANSITION_ACCEPT | 44,
+			[0x2e] = SCAN_CODE_TRANSITION_ACCEPT | 45,
+			[0x2f] = SCAN_CODE_TRANSITION_ACCEPT | 46,
+			[0x30] = SCAN_CODE_TRANSITION_ACCEPT | 47,
+			[0x31] = SCAN_CODE_TRANSITION_ACCEPT | 48,
+			[0x32] = SCAN_CODE_TRANSITION_ACCEPT | 49,
+			[0x33] = SCAN_CODE_TRANSITION_ACCEPT | 50,
+			[0x34] = SCAN_CODE_TRANSITION_ACCEPT | 51,
+			[0x35] = SCAN_CODE_TRANSITION_ACCEPT | 52,
+			[0x36] = SCAN_CODE_TRANSITION_ACCEPT | 53,
+			[0x37] = SCAN_CODE_TRANSITION_ACCEPT | 54,
+			[0x38] = SCAN_CODE_TRANSITION_ACCEPT | 55,
+			[0x39] = SCAN_CODE_TRANSITION_ACCEPT | 56,
+			[0x3a] = SCAN_CODE_TRANSITION_ACCEPT | 57,
+			[0x3b] = SCAN_CODE_TRANSITION_ACCEPT | 58,
+			[0x3c] = SCAN_CODE_TRANSITION_ACCEPT | 59,
+			[0x3d] = SCAN_CODE_TRANSITION_ACCEPT | 60,
+			[0x3e] = SCAN_CODE_TRANSITION_ACCEPT | 61,
+			[0x3f] = SCAN_CODE_TRANSITION_ACCEPT | 62,
+			[0x40] = SCAN_CODE_TRANSITION_ACCEPT | 63,
+			[0x41] = SCAN_CODE_TRANSITION_ACCEPT | 64,
+			[0x42] = SCAN_CODE_TRANSITION_ACCEPT | 65,
+			[0x43] = SCAN_CODE_TRANSITION_ACCEPT | 66,
+			[0x44] = SCAN_CODE_TRANSITION_ACCEPT | 67,
+			[0x45] = SCAN_CODE_TRANSITION_ACCEPT | 68,
+			[0x46] = SCAN_CODE_TRANSITION_ACCEPT | 69,
+			[0x47] = SCAN_CODE_TRANSITION_ACCEPT | 70,
+			[0x48] = SCAN_CODE_TRANSITION_ACCEPT | 71,
+			[0x49] = SCAN_CODE_TRANSITION_ACCEPT | 72,
+			[0x4a] = SCAN_CODE_TRANSITION_ACCEPT | 73,
+			[0x4b] = SCAN_CODE_TRANSITION_ACCEPT | 74,
+			[0x4c] = SCAN_CODE_TRANSITION_ACCEPT | 75,
+			[0x4d] = SCAN_CODE_TRANSITION_ACCEPT | 76,
+			[0x4e] = SCAN_CODE_TRANSITION_ACCEPT | 77,
+			[0x4f] = SCAN_CODE_TRANSITION_ACCEPT | 78,
+			[0x50] = SCAN_CODE_TRANSITION_ACCEPT | 79,
+			[0x51] = SCAN_CODE_TRANSITION_ACCEPT | 80,
+			[0x52] = SCAN_CODE_TRANSITION_ACCEPT | 81,
+			[0x53] = SCAN_CODE_TRANSITION_ACCEPT | 82,
+			[0x57] = SCAN_CODE_TRANSITION_ACCEPT | 83,
+			[0x58] = SCAN_CODE_TRANSITION_ACCEPT | 84,
+			[0x81] = SCAN_CODE_TRANSITION_ACCEPT | 85,
+			[0x82] = SCAN_CODE_TRANSITION_ACCEPT | 86,
+			[0x83] = SCAN_CODE_TRANSITION_ACCEPT | 87,
+			[0x84] = SCAN_CODE_TRANSITION_ACCEPT | 88,
+			[0x85] = SCAN_CODE_TRANSITION_ACCEPT | 89,
+			[0x86] = SCAN_CODE_TRANSITION_ACCEPT | 90,
+			[0x87] = SCAN_CODE_TRANSITION_ACCEPT | 91,
+			[0x88] = SCAN_CODE_TRANSITION_ACCEPT | 92,
+			[0x89] = SCAN_CODE_TRANSITION_ACCEPT | 93,
+			[0x8a] = SCAN_CODE_TRANSITION_ACCEPT | 94,
+			[0x8b] = SCAN_CODE_TRANSITION_ACCEPT | 95,
+			[0x8c] = SCAN_CODE_TRANSITION_ACCEPT | 96,
+			[0x8d] = SCAN_CODE_TRANSITION_ACCEPT | 97,
+			[0x8e] = SCAN_CODE_TRANSITION_ACCEPT | 98,
+			[0x8f] = SCAN_CODE_TRANSITION_ACCEPT | 99,
+			[0x90] = SCAN_CODE_TRANSITION_ACCEPT | 100,
+			[0x91] = SCAN_CODE_TRANSITION_ACCEPT | 101,
+			[0x92] = SCAN_CODE_TRANSITION_ACCEPT | 102,
+			[0x93] = SCAN_CODE_TRANSITION_ACCEPT | 103,
+			[0x94] = SCAN_CODE_TRANSITION_ACCEPT | 104,
+			[0x95] = SCAN_CODE_TRANSITION_ACCEPT | 105,
+			[0x96] = SCAN_CODE_TRANSITION_ACCEPT | 106,
+			[0x97] = SCAN_CODE_TRANSITION_ACCEPT | 107,
+			[0x98] = SCAN_CODE_TRANSITION_ACCEPT | 108,
+			[0x99] = SCAN_CODE_TRANSITION_ACCEPT | 109,
+			[0x9a] = SCAN_CODE_TRANSITION_ACCEPT | 110,
+			[0x9b] = SCAN_CODE_TRANSITION_ACCEPT | 111,
+			[0x9c] = SCAN_CODE_TRANSITION_ACCEPT | 112,
+			[0x9d] = SCAN_CODE_TRANSITION_ACCEPT | 113,
+			[0x9e] = SCAN_CODE_TRANSITION_ACCEPT | 114,
+			[0x9f] = SCAN_CODE_TRANSITION_ACCEPT | 115,
+			[0xa0] = SCAN_CODE_TRANSITION_ACCEPT | 116,
+			[0xa1] = SCAN_CODE_TRANSITION_ACCEPT | 117,
+			[0xa2] = SCAN_CODE_TRANSITION_ACCEPT | 118,
+			[0xa3] = SCAN_CODE_TRANSITION_ACCEPT | 119,
+			[0xa4] = SCAN_CODE_TRANSITION_ACCEPT | 120,
+			[0xa5] = SCAN_CODE_TRANSITION_ACCEPT | 121,
+			[0xa6] = SCAN_CODE_TRANSITION_ACCEPT | 122,
+			[0xa7] = SCAN_CODE_TRANSITION_ACCEPT | 123,
+			[0xa8] = SCAN_CODE_TRANSITION_ACCEPT | 124,
+			[0xa9] = SCAN_CODE_TRANSITION_ACCEPT | 125,
+			[0xaa] = SCAN_CODE_TRANSITION_ACCEPT | 126,
+			[0xab] = SCAN_CODE_TRANSITION_ACCEPT | 127,
+			[0xac] = SCAN_CODE_TRANSITION_ACCEPT | 128,
+			[0xad] = SCAN_CODE_TRANSITION_ACCEPT | 129,
+			[0xae] = SCAN_CODE_TRANSITION_ACCEPT | 130,
+			[0xaf] = SCAN_CODE_TRANSITION_ACCEPT | 131,
+			[0xb0] = SCAN_CODE_TRANSITION_ACCEPT | 132,
+			[0xb1] = SCAN_CODE_TRANSITION_ACCEPT | 133,
+			[0xb2] = SCAN_CODE_TRANSITION_ACCEPT | 134,
+			[0xb3] = SCAN_CODE_TRANSITION_ACCEPT | 135,
+			[0xb4] = SCAN_CODE_TRANSITION_ACCEPT | 136,
+			[0xb5] = SCAN_CODE_TRANSITION_ACCEPT | 137,
+			[0xb6] = SCAN_CODE_TRANSITION_ACCEPT | 138,
+			[0xb7] = SCAN_CODE_TRANSITION_ACCEPT | 139,
+			[0xb8] = SCAN_CODE_TRANSITION_ACCEPT | 140,
+			[0xb9] = SCAN_CODE_TRANSITION_ACCEPT | 141,
+			[0xba] = SCAN_CODE_TRANSITION_ACCEPT | 142,
+			[0xbb] = SCAN_CODE_TRANSITION_ACCEPT | 143,
+			[0xbc] = SCAN_CODE_TRANSITION_ACCEPT | 144,
+			[0xbd] = SCAN_CODE_TRANSITION_ACCEPT | 145,
+			[0xbe] = SCAN_CODE_TRANSITION_ACCEPT | 146,
+			[0xbf] = SCAN_CODE_TRANSITION_ACCEPT | 147,
+			[0xc0] = SCAN_CODE_TRANSITION_ACCEPT | 148,
+			[0xc1] = SCAN_CODE_TRANSITION_ACCEPT | 149,
+			[0xc2] = SCAN_CODE_TRANSITION_ACCEPT | 150,
+			[0xc3] = SCAN_CODE_TRANSITION_ACCEPT | 151,
+			[0xc4] = SCAN_CODE_TRANSITION_ACCEPT | 152,
+			[0xc5] = SCAN_CODE_TRANSITION_ACCEPT | 153,
+			[0xc6] = SCAN_CODE_TRANSITION_ACCEPT | 154,
+			[0xc7] = SCAN_CODE_TRANSITION_ACCEPT | 155,
+			[0xc8] = SCAN_CODE_TRANSITION_ACCEPT | 156,
+			[0xc9] = SCAN_CODE_TRANSITION_ACCEPT | 157,
+			[0xca] = SCAN_CODE_TRANSITION_ACCEPT | 158,
+			[0xcb] = SCAN_CODE_TRANSITION_ACCEPT | 159,
+			[0xcc] = SCAN_CODE_TRANSITION_ACCEPT | 160,
+			[0xcd] = SCAN_CODE_TRANSITION_ACCEPT | 161,
+			[0xce] = SCAN_CODE_TRANSITION_ACCEPT | 162,
+			[0xcf] = SCAN_CODE_TRANSITION_ACCEPT | 163,
+			[0xd0] = SCAN_CODE_TRANSITION_ACCEPT | 164,
+			[0xd1] = SCAN_CODE_TRANSITION_ACCEPT | 165,
+			[0xd2] = SCAN_CODE_TRANSITION_ACCEPT | 166,
+			[0xd3] = SCAN_CODE_TRANSITION_ACCEPT | 167,
+			[0xd7] = SCAN_CODE_TRANSITION_ACCEPT | 168,
+			[0xd8] = SCAN_CODE_TRANSITION_ACCEPT | 169,
+			[0xe0] = 1,
+			[0xe1] = 6,
+		},
+		[1] = {
+			[0x10] = SCAN_CODE_TRANSITION_ACCEPT | 170,
+			[0x19] = SCAN_CODE_TRANSITION_ACCEPT | 171,
+			[0x1c] = SCAN_CODE_TRANSITION_ACCEPT | 172,
+			[0x1d] = SCAN_CODE_TRANSITION_ACCEPT | 173,
+			[0x20] = SCAN_CODE_TRANSITION_ACCEPT | 174,
+			[0x21] = SCAN_CODE_TRANSITION_ACCEPT | 175,
+			[0x22] = SCAN_CODE_TRANSITION_ACCEPT | 176,
+			[0x24] = SCAN_CODE_TRANSITION_ACCEPT | 177,
+			[0x2a] = 2,
+			[0x2e] = SCAN_CODE_TRANSITION_ACCEPT | 178,
+			[0x30] = SCAN_CODE_TRANSITION_ACCEPT | 179,
+			[0x32] = SCAN_CODE_TRANSITION_ACCEPT | 180,
+			[0x35] = SCAN_CODE_TRANSITION_ACCEPT | 181,
+			[0x38] = SCAN_CODE_TRANSITION_ACCEPT | 182,
+			[0x47] = SCAN_CODE_TRANSITION_ACCEPT | 183,
+			[0x48] = SCAN_CODE_TRANSITION_ACCEPT | 184,
+			[0x49] = SCAN_CODE_TRANSITION_ACCEPT | 185,
+			[0x4b] = SCAN_CODE_TRANSITION_ACCEPT | 186,
+			[0x4d] = SCAN_CODE_TRANSITION_ACCEPT | 187,
+			[0x4f] = SCAN_CODE_TRANSITION_ACCEPT | 188,
+			[0x50] = SCAN_CODE_TRANSITION_ACCEPT | 189,
+			[0x51] = SCAN_CODE_TRANSITION_ACCEPT | 190,
+			[0x52] = SCAN_CODE_TRANSITION_ACCEPT | 191,
+			[0x53] = SCAN_CODE_TRANSITION_ACCEPT | 192,
+			[0x5b] = SCAN_CODE_TRANSITION_ACCEPT | 193,
+			[0x5c] = SCAN_CODE_TRANSITION_ACCEPT | 194,
+			[0x5d] = SCAN_CODE_TRANSITION_ACCEPT | 195,
+			[0x5e] = SCAN_CODE_TRANSITION_ACCEPT | 196,
+			[0x5f] = SCAN_CODE_TRANSITION_ACCEPT | 197,
+			[0x63] = SCAN_CODE_TRANSITION_ACCEPT | 198,
+			[0x65] = SCAN_CODE_TRANSITION_ACCEPT | 199,
+			[0x66] = SCAN_CODE_TRANSITION_ACCEPT | 200,
+			[0x67] = SCAN_CODE_TRANSITION_ACCEPT | 201,
+			[0x68] = SCAN_CODE_TRANSITION_ACCEPT | 202,
+			[0x69] = SCAN_CODE_TRANSITION_ACCEPT | 203,
+			[0x6a] = SCAN_CODE_TRANSITION_ACCEPT | 204,
+			[0x6b] = SCAN_CODE_TRANSITION_ACCEPT | 205,
+			[0x6c] = SCAN_CODE_TRANSITION_ACCEPT | 206,
+			[0x6d] = SCAN_CODE_TRANSITION_ACCEPT | 207,
+			[0x90] = SCAN_CODE_TRANSITION_ACCEPT | 208,
+			[0x99] = SCAN_CODE_TRANSITION_ACCEPT | 209,
+			[0x9c] = SCAN_CODE_TRANSITION_ACCEPT | 210,
+			[0x9d] = SCAN_CODE_TRANSITION_ACCEPT | 211,
+			[0xa0] = SCAN_CODE_TRANSITION_ACCEPT | 212,
+			[0xa1] = SCAN_CODE_TRANSITION_ACCEPT | 213,
+			[0xa2] = SCAN_CODE_TRANSITION_ACCEPT | 214,
+			[0xa4] = SCAN_CODE_TRANSITION_ACCEPT | 215,
+			[0xae] = SCAN_CODE_TRANSITION_ACCEPT | 216,
+			[0xb0] = SCAN_CODE_TRANSITION_ACCEPT | 217,
+			[0xb2] = SCAN_CODE_TRANSITION_ACCEPT | 218,
+			[0xb5] = SCAN_CODE_TRANSITION_ACCEPT | 219,
+			[0xb7] = 4,
+			[0xb8] = SCAN_CODE_TRANSITION_ACCEPT | 220,
+			[0xc7] = SCAN_CODE_TRANSITION_ACCEPT | 221,
+			[0xc8] = SCAN_CODE_TRANSITION_ACCEPT | 222,
+			[0xc9] = SCAN_CODE_TRANSITION_ACCEPT | 223,
+			[0xcb] = SCAN_CODE_TRANSITION_ACCEPT | 224,
+			[0xcd] = SCAN_CODE_TRANSITION_ACCEPT | 225,
+			[0xcf] = SCAN_CODE_TRANSITION_ACCEPT | 226,
+			[0xd0] = SCAN_CODE_TRANSITION_ACCEPT | 227,
+			[0xd1] = SCAN_CODE_TRANSITION_ACCEPT | 228,
+			[0xd2] = SCAN_CODE_TRANSITION_ACCEPT | 229,
+			[0xd3] = SCAN_CODE_TRANSITION_ACCEPT | 230,
+			[0xdb] = SCAN_CODE_TRANSITION_ACCEPT | 231,
+			[0xdc] = SCAN_CODE_TRANSITION_ACCEPT | 232,
+			[0xdd] = SCAN_CODE_TRANSITION_ACCEPT | 233,
+			[0xde] = SCAN_CODE_TRANSITION_ACCEPT | 234,
+			[0xdf] = SCAN_CODE_TRANSITION_ACCEPT | 235,
+			[0xe3] = SCAN_CODE_TRANSITION_ACCEPT | 236,
+			[0xe5] = SCAN_CODE_TRANSITION_ACCEPT | 237,
+			[0xe6] = SCAN_CODE_TRANSITION_ACCEPT | 238,
+			[0xe7] = SCAN_CODE_TRANSITION_ACCEPT | 239,
+			[0xe8] = SCAN_CODE_TRANSITION_ACCEPT | 240,
+			[0xe9] = SCAN_CODE_TRANSITION_ACCEPT | 241,
+			[0xea] = SCAN_CODE_TRANSITION_ACCEPT | 242,
+			[0xeb] = SCAN_CODE_TRANSITION_ACCEPT | 243,
+			[0xec] = SCAN_CODE_TRANSITION_ACCEPT | 244,
+			[0xed] = SCAN_CODE_TRANSITION_ACCEPT | 245,
+		},
+		[2] = {
+			[0xe0] = 3,
+		},
+		[3] = {
+			[0x37] = SCAN_CODE_TRANSITION_ACCEPT | 246,
+		},
+		[4] = {
+			[0xe0] = 5,
+		},
+		[5] = {
+			[0xaa] = SCAN_CODE_TRANSITION_ACCEPT | 247,
+		},
+		[6] = {
+			[0x1d] = 7,
+		},
+		[7] = {
+			[0x45] = 8,
+		},
+		[8] = {
+			[0xe1] = 9,
+		},
+		[9] = {
+			[0x9d] = 10,
+		},
+		[10] = {
+			[0xc5] = SCAN_CODE_TRANSITION_ACCEPT | 248,
+		},
+	},
+	.states_len = 11,
+};
+
+const struct scan_code_set	scan_code_set_1 = {
+	.keys = scan_code_set_1_keys,
+	.len = sizeof(scan_code_set_1_keys) / sizeof(*scan_code_set_1_keys),
+	.index = &scan_code_set_1_index,
+	.automaton = &scan_code_set_1_automaton,
+	.break_prefix = 0,
+};
+
+static const struct scan_key_code	scan_code_set_2_keys[] = {
+	{ 0x1, scan_code_names + 250, PRESSED, 0x0, PS2_MODIFIER_NONE, 66 }, // 0: "F9"
+	{ 0x3, scan_code_names + 238, PRESSED, 0x0, PS2_MODIFIER_NONE, 62 }, // 1: "F5"
+	{ 0x4, scan_code_names + 232, PRESSED, 0x0, PS2_MODIFIER_NONE, 60 }, // 2: "F3"
+	{ 0x5, scan_code_names + 226, PRESSED, 0x0, PS2_MODIFIER_NONE, 58 }, // 3: "F1"
+	{ 0x6, scan_code_names + 229, PRESSED, 0x0, PS2_MODIFIER_NONE, 59 }, // 4: "F2"
+	{ 0x7, scan_code_names + 426, PRESSED, 0x0, PS2_MODIFIER_NONE, 84 }, // 5: "F12"
+	{ 0x9, scan_code_names + 253, PRESSED, 0x0, PS2_MODIFIER_NONE, 67 }, // 6: "F10"
+	{ 0xa, scan_code_names + 247, PRESSED, 0x0, PS2_MODIFIER_NONE, 65 }, // 7: "F8"
+	{ 0xb, scan_code_names + 241, PRESSED, 0x0, PS2_MODIFIER_NONE, 63 }, // 8: "F6"
+	{ 0xc, scan_code_names + 235, PRESSED, 0x0, PS2_MODIFIER_NONE, 61 }, // 9: "F4"
+	{ 0xd, scan_code_names + 48, PRESSED, '\t', PS2_MODIFIER_NONE, 14 }, // 10: "tab"
+	{ 0xe, scan_code_names + 132, PRESSED, '`', PS2_MODIFIER_NONE, 40 }, // 11: "` (back tick)"
+	{ 0x11, scan_code_names + 202, PRESSED, 0x0, PS2_MODIFIER_LEFT_ALT, 55 }, // 12: "left alt"
+	{ 0x12, scan_code_names + 146, PRESSED, 0x0, PS2_MODIFIER_LEFT_SHIFT, 41 }, // 13: "left shift"
+	{ 0x14, scan_code_names + 82, PRESSED, 0x0, PS2_MODIFIER_LEFT_CONTROL, 28 }, // 14: "left control"
+	{ 0x15, scan_code_names + 52, PRESSED, 'q', PS2_MODIFIER_NONE, 15 }, // 15: "Q"
+	{ 0x16, scan_code_names + 7, PRESSED, '1', PS2_MODIFIER_NONE, 1 }, // 16: "1"
+	{ 0x1a, scan_code_names + 159, PRESSED, 'z', PS2_MODIFIER_NONE, 43 }, // 17: "Z"
+	{ 0x1b, scan_code_names + 97, PRESSED, 's', PS2_MODIFIER_NONE, 30 }, // 18: "S"
+	{ 0x1c, scan_code_names + 95, PRESSED, 'a', PS2_MODIFIER_NONE, 29 }, // 19: "A"
+	{ 0x1d, scan_code_names + 54, PRESSED, 'w', PS2_MODIFIER_NONE, 16 }, // 20: "W"
+	{ 0x1e, scan_code_names + 9, PRESSED, '2', PS2_MODIFIER_NONE, 2 }, // 21: "2"
+	{ 0x21, scan_code_names + 163, PRESSED, 'c', PS2_MODIFIER_NONE, 45 }, // 22: "C"
+	{ 0x22, scan_code_names + 161, PRESSED, 'x', PS2_MODIFIER_NONE, 44 }, // 23: "X"
+	{ 0x23, scan_code_names + 99, PRESSED, 'd', PS2_MODIFIER_NONE, 31 }, // 24: "D"
+	{ 0x24, scan_code_names + 56, PRESSED, 'e', PS2_MODIFIER_NONE, 17 }, // 25: "E"
+	{ 0x25, scan_code_names + 13, PRESSED, '4', PS2_MODIFIER_NONE, 4 }, // 26: "4"
+	{ 0x26, scan_code_names + 11, PRESSED, '3', PS2_MODIFIER_NONE, 3 }, // 27: "3"
+	{ 0x29, scan_code_names + 211, PRESSED, ' ', PS2_MODIFIER_NONE, 56 }, // 28: "space"
+	{ 0x2a, scan_code_names + 165, PRESSED, 'v', PS2_MODIFIER_NONE, 46 }, // 29: "V"
+	{ 0x2b, scan_code_names + 101, PRESSED, 'f', PS2_MODIFIER_NONE, 32 }, // 30: "F"
+	{ 0x2c, scan_code_names + 60, PRESSED, 't', PS2_MODIFIER_NONE, 19 }, // 31: "T"
+	{ 0x2d, scan_code_names + 58, PRESSED, 'r', PS2_MODIFIER_NONE, 18 }, // 32: "R"
+	{ 0x2e, scan_code_names + 15, PRESSED, '5', PS2_MODIFIER_NONE, 5 }, // 33: "5"
+	{ 0x31, scan_code_names + 169, PRESSED, 'n', PS2_MODIFIER_NONE, 48 }, // 34: "N"
+	{ 0x32, scan_code_names + 167, PRESSED, 'b', PS2_MODIFIER_NONE, 47 }, // 35: "B"
+	{ 0x33, scan_code_names + 105, PRESSED, 'h', PS2_MODIFIER_NONE, 34 }, // 36: "H"
+	{ 0x34, scan_code_names + 103, PRESSED, 'g', PS2_MODIFIER_NONE, 33 }, // 37: "G"
+	{ 0x35, scan_code_names + 62, PRESSED, 'y', PS2_MODIFIER_NONE, 20 }, // 38: "Y"
+	{ 0x36, scan_code_names + 17, PRESSED, '6', PS2_MODIFIER_NONE, 6 }, // 39: "6"
+	{ 0x3a, scan_code_names + 171, PRESSED, 'm', PS2_MODIFIER_NONE, 49 }, // 40: "M"
+	{ 0x3b, scan_code_names + 107, PRESSED, 'j', PS2_MODIFIER_NONE, 35 }, // 41: "J"
+	{ 0x3c, scan_code_names + 64, PRESSED, 'u', PS2_MODIFIER_NONE, 21 }, // 42: "U"
+	{ 0x3d, scan_code_names + 19, PRESSED, '7', PS2_MODIFIER_NONE, 7 }, // 43: "7"
+	{ 0x3e, scan_code_names + 21, PRESSED, '8', PS2_MODIFIER_NONE, 8 }, // 44: "8"
+	{ 0x41, scan_code_names + 173, PRESSED, ',', PS2_MODIFIER_NONE, 50 }, // 45: ","
+	{ 0x42, scan_code_names + 109, PRESSED, 'k', PS2_MODIFIER_NONE, 36 }, // 46: "K"
+	{ 0x43, scan_code_names + 66, PRESSED, 'i', PS2_MODIFIER_NONE, 22 }, // 47: "I"
+	{ 0x44, scan_code_names + 68, PRESSED, 'o', PS2_MODIFIER_NONE, 23 }, // 48: "O"
+	{ 0x45, scan_code_names + 25, PRESSED, '0', PS2_MODIFIER_NONE, 10 }, // 49: "0 (zero)"
+	{ 0x46, scan_code_names + 23, PRESSED, '9', PS2_MODIFIER_NONE, 9 }, // 50: "9"
+	{ 0x49, scan_code_names + 175, PRESSED, '.', PS2_MODIFIER_NONE, 51 }, // 51: "."
+	{ 0x4a, scan_code_names + 177, PRESSED, '/', PS2_MODIFIER_NONE, 52 }, // 52: "/"
+	{ 0x4b, scan_code_names + 111, PRESSED, 'l', PS2_MODIFIER_NONE, 37 }, // 53: "L"
+	{ 0x4c, scan_code_names + 113, PRESSED, ';', PS2_MODIFIER_NONE, 38 }, // 54: ";"
+	{ 0x4d, scan_code_names + 70, PRESSED, 'p', PS2_MODIFIER_NONE, 24 }, // 55: "P"
+	{ 0x4e, scan_code_names + 34, PRESSED, '-', PS2_MODIFIER_NONE, 11 }, // 56: "-"
+	{ 0x52, scan_code_names + 115, PRESSED, '\'', PS2_MODIFIER_NONE, 39 }, // 57: "' (single quote)"
+	{ 0x54, scan_code_names + 72, PRESSED, '[', PS2_MODIFIER_NONE, 25 }, // 58: "["
+	{ 0x55, scan_code_names + 36, PRESSED, '=', PS2_MODIFIER_NONE, 12 }, // 59: "="
+	{ 0x58, scan_code_names + 217, PRESSED, 0x0, PS2_MODIFIER_CAPSLOCK, 57 }, // 60: "CapsLock"
+	{ 0x59, scan_code_names + 179, PRESSED, 0x0, PS2_MODIFIER_RIGHT_SHIFT, 53 }, // 61: "right shift"
+	{ 0x5a, scan_code_names + 76, PRESSED, '\n', PS2_MODIFIER_NONE, 27 }, // 62: "enter"
+	{ 0x5b, scan_code_names + 74, PRESSED, ']', PS2_MODIFIER_NONE, 26 }, // 63: "]"
+	{ 0x5d, scan_code_names + 157, PRESSED, '\\', PS2_MODIFIER_NONE, 42 }, // 64: "\\"
+	{ 0x66, scan_code_names + 38, PRESSED, 0x0, PS2_MODIFIER_NONE, 13 }, // 65: "backspace"
+	{ 0x69, scan_code_names + 367, PRESSED, '1', PS2_MODIFIER_NONE, 78 }, // 66: "(keypad) 1"
+	{ 0x6b, scan_code_names + 323, PRESSED, '4', PS2_MODIFIER_NONE, 74 }, // 67: "(keypad) 4"
+	{ 0x6c, scan_code_names + 279, PRESSED, '7', PS2_MODIFIER_NONE, 70 }, // 68: "(keypad) 7"
+	{ 0x70, scan_code_names + 400, PRESSED, '0', PS2_MODIFIER_NONE, 81 }, // 69: "(keypad) 0"
+	{ 0x71, scan_code_names + 411, PRESSED, '.', PS2_MODIFIER_NONE, 82 }, // 70: "(keypad) ."
+	{ 0x72, scan_code_names + 378, PRESSED, '2', PS2_MODIFIER_NONE, 79 }, // 71: "(keypad) 2"
+	{ 0x73, scan_code_names + 334, PRESSED, '5', PS2_MODIFIER_NONE, 75 }, // 72: "(keypad) 5"
+	{ 0x74, scan_code_names + 345, PRESSED, '6', PS2_MODIFIER_NONE, 76 }, // 73: "(keypad) 6"
+	{ 0x75, scan_code_names + 290, PRESSED, '8', PS2_MODIFIER_NONE, 71 }, // 74: "(keypad) 8"
+	{ 0x76, scan_code_names + 0, PRESSED, 0x0, PS2_MODIFIER_ESCAPE, 0 }, // 75: "escape"
+	{ 0x77, scan_code_names + 257, PRESSED, 0x0, PS2_MODIFIER_NUMBER_LOCK, 68 }, // 76: "NumberLock"
+	{ 0x78, scan_code_names + 422, PRESSED, 0x0, PS2_MODIFIER_NONE, 83 }, // 77: "F11"
+	{ 0x79, scan_code_names + 356, PRESSED, '+', PS2_MODIFIER_NONE, 77 }, // 78: "(keypad) +"
+	{ 0x7a, scan_code_names + 389, PRESSED, '3', PS2_MODIFIER_NONE, 80 }, // 79: "(keypad) 3"
+	{ 0x7b, scan_code_names + 312, PRESSED, '-', PS2_MODIFIER_NONE, 73 }, // 80: "(keypad) -"
+	{ 0x7c, scan_code_names + 191, PRESSED, '*', PS2_MODIFIER_NONE, 54 }, // 81: "(keypad) *"
+	{ 0x7d, scan_code_names + 301, PRESSED, '9', PS2_MODIFIER_NONE, 72 }, // 82: "(keypad) 9"
+	{ 0x7e, scan_code_names + 268, PRESSED, 0x0, PS2_MODIFIER_SCROLL_LOCK, 69 }, // 83: "ScrollLock"
+	{ 0x83, scan_code_names + 244, PRESSED, 0x0, PS2_MODIFIER_NONE, 64 }, // 84: "F7"
+	{ 0xe010, scan_code_names + 843, PRESSED, 0x0, PS2_MODIFIER_NONE, 114 }, // 85: "(multimedia) WWW search"
+	{ 0xe011, scan_code_names + 670, PRESSED, 0x0, PS2_MODIFIER_RIGHT_ALT, 97 }, // 86: "right alt (or altGr)"
+	{ 0xe014, scan_code_names + 497, PRESSED, 0x0, PS2_MODIFIER_RIGHT_CONTROL, 88 }, // 87: "right control"
+	{ 0xe015, scan_code_names + 430, PRESSED, 0x0, PS2_MODIFIER_NONE, 85 }, // 88: "(multimedia) previous track"
+	{ 0xe018, scan_code_names + 867, PRESSED, 0x0, PS2_MODIFIER_NONE, 115 }, // 89: "(multimedia) WWW favorites"
+	{ 0xe01f, scan_code_names + 779, PRESSED, 0x0, PS2_MODIFIER_NONE, 108 }, // 90: "left GUI"
+	{ 0xe020, scan_code_names + 894, PRESSED, 0x0, PS2_MODIFIER_NONE, 116 }, // 91: "(multimedia) WWW refresh"
+	{ 0xe021, scan_code_names + 589, PRESSED, 0x0, PS2_MODIFIER_NONE, 93 }, // 92: "(multimedia) volume down"
+	{ 0xe023, scan_code_names + 511, PRESSED, 0x0, PS2_MODIFIER_NONE, 89 }, // 93: "(multimedia) mute"
+	{ 0xe027, scan_code_names + 788, PRESSED, 0x0, PS2_MODIFIER_NONE, 109 }, // 94: "right GUI"
+	{ 0xe028, scan_code_names + 919, PRESSED, 0x0, PS2_MODIFIER_NONE, 117 }, // 95: "(multimedia) WWW stop"
+	{ 0xe02b, scan_code_names + 529, PRESSED, 0x0, PS2_MODIFIER_NONE, 90 }, // 96: "(multimedia) calculator"
+	{ 0xe02f, scan_code_names + 798, PRESSED, 0x0, PS2_MODIFIER_NONE, 110 }, // 97: "\"apps\""
+	{ 0xe030, scan_code_names + 941, PRESSED, 0x0, PS2_MODIFIER_NONE, 118 }, // 98: "(multimedia) WWW forward"
+	{ 0xe032, scan_code_names + 614, PRESSED, 0x0, PS2_MODIFIER_NONE, 94 }, // 99: "(multimedia) volume up"
+	{ 0xe034, scan_code_names + 553, PRESSED, 0x0, PS2_MODIFIER_NONE, 91 }, // 100: "(multimedia) play"
+	{ 0xe037, scan_code_names + 805, PRESSED, 0x0, PS2_MODIFIER_NONE, 111 }, // 101: "(ACPI) power"
+	{ 0xe038, scan_code_names + 966, PRESSED, 0x0, PS2_MODIFIER_NONE, 119 }, // 102: "(multimedia) WWW back"
+	{ 0xe03a, scan_code_names + 637, PRESSED, 0x0, PS2_MODIFIER_NONE, 95 }, // 103: "(multimedia) WWW home"
+	{ 0xe03b, scan_code_names + 571, PRESSED, 0x0, PS2_MODIFIER_NONE, 92 }, // 104: "(multimedia) stop"
+	{ 0xe03f, scan_code_names + 818, PRESSED, 0x0, PS2_MODIFIER_NONE, 112 }, // 105: "(ACPI) sleep"
+	{ 0xe040, scan_code_names + 988, PRESSED, 0x0, PS2_MODIFIER_NONE, 120 }, // 106: "(multimedia) my computer"
+	{ 0xe048, scan_code_names + 1013, PRESSED, 0x0, PS2_MODIFIER_NONE, 121 }, // 107: "(multimedia) email"
+	{ 0xe04a, scan_code_names + 659, PRESSED, '/', PS2_MODIFIER_NONE, 96 }, // 108: "(keypad) /"
+	{ 0xe04d, scan_code_names + 458, PRESSED, 0x0, PS2_MODIFIER_NONE, 86 }, // 109: "(multimedia) next track"
+	{ 0xe050, scan_code_names + 1032, PRESSED, 0x0, PS2_MODIFIER_NONE, 122 }, // 110: "(multimedia) media select"
+	{ 0xe05a, scan_code_names + 482, PRESSED, '\n', PS2_MODIFIER_NONE, 87 }, // 111: "(keypad) enter"
+	{ 0xe05e, scan_code_names + 831, PRESSED, 0x0, PS2_MODIFIER_NONE, 113 }, // 112: "(ACPI) wake"
+	{ 0xe069, scan_code_names + 739, PRESSED, 0x0, PS2_MODIFIER_NONE, 103 }, // 113: "end"
+	{ 0xe06b, scan_code_names + 714, PRESSED, 0x0, PS2_MODIFIER_NONE, 101 }, // 114: "cursor left"
+	{ 0xe06c, scan_code_names + 691, PRESSED, 0x0, PS2_MODIFIER_NONE, 98 }, // 115: "home"
+	{ 0xe070, scan_code_names + 765, PRESSED, 0x0, PS2_MODIFIER_NONE, 106 }, // 116: "insert"
+	{ 0xe071, scan_code_names + 772, PRESSED, 0x0, PS2_MODIFIER_NONE, 107 }, // 117: "delete"
+	{ 0xe072, scan_code_names + 743, PRESSED, 0x0, PS2_MODIFIER_NONE, 104 }, // 118: "cursor down"
+	{ 0xe074, scan_code_names + 726, PRESSED, 0x0, PS2_MODIFIER_NONE, 102 }, // 119: "cursor right"
+	{ 0xe075, scan_code_names + 696, PRESSED, 0x0, PS2_MODIFIER_NONE, 99 }, // 120: "cursor up"
+	{ 0xe07a, scan_code_names + 755, PRESSED, 0x0, PS2_MODIFIER_NONE, 105 }, // 121: "page down"
+	{ 0xe07d, scan_code_names + 706, PRESSED, 0x0, PS2_MODIFIER_NONE, 100 }, // 122: "page up"
+	{ 0xe012e07c, scan_code_names + 1058, PRESSED, 0x0, PS2_MODIFIER_NONE, 123 }, // 123: "print screen"
+	{ 0xe07ce012, scan_code_names + 1058, RELEASED, 0x0, PS2_MODIFIER_NONE, 123 }, // 124: "print screen"
+	{ 0xe11477e1f014f077, scan_code_names + 1071, PRESSED, 0x0, PS2_MODIFIER_NONE, 124 }, // 125: "pause"
+};
+
+static const struct scan_code_index	scan_code_set_2_index = {
+	.single = {
+		[0x1] = &scan_code_set_2_keys[0], // 0x1
+		[0x3] = &scan_code_set_2_keys[1], // 0x3
+		[0x4] = &scan_code_set_2_keys[2], // 0x4
+		[0x5] = &scan_code_set_2_keys[3], // 0x5
+		[0x6] = &scan_code_set_2_keys[4], // 0x6
+		[0x7] = &scan_code_set_2_keys[5], // 0x7
+		[0x9] = &scan_code_set_2_keys[6], // 0x9
+		[0xa] = &scan_code_set_2_keys[7], // 0xa
+		[0xb] = &scan_code_set_2_keys[8], // 0xb
+		[0xc] = &scan_code_set_2_keys[9], // 0xc
+		[0xd] = &scan_code_set_2_keys[10], // 0xd
+		[0xe] = &scan_code_set_2_keys[11], // 0xe
+		[0x11] = &scan_code_set_2_keys[12], // 0x11
+		[0x12] = &scan_code_set_2_keys[13], // 0x12
+		[0x14] = &scan_code_set_2_keys[14], // 0x14
+		[0x15] = &scan_code_set_2_keys[15], // 0x15
+		[0x16] = &scan_code_set_2_keys[16], // 0x16
+		[0x1a] = &scan_code_set_2_keys[17], // 0x1a
+		[0x1b] = &scan_code_set_2_keys[18], // 0x1b
+		[0x1c] = &scan_code_set_2_keys[19], // 0x1c
+		[0x1d] = &scan_code_set_2_keys[20], // 0x1d
+		[0x1e] = &scan_code_set_2_keys[21], // 0x1e
+		[0x21] = &scan_code_set_2_keys[22], // 0x21
+		[0x22] = &scan_code_set_2_keys[23], // 0x22
+		[0x23] = &scan_code_set_2_keys[24], // 0x23
+		[0x24] = &scan_code_set_2_keys[25], // 0x24
+		[0x25] = &scan_code_set_2_keys[26], // 0x25
+		[0x26] = &scan_code_set_2_keys[27], // 0x26
+		[0x29] = &scan_code_set_2_keys[28], // 0x29
+		[0x2a] = &scan_code_set_2_keys[29], // 0x2a
+		[0x2b] = &scan_code_set_2_keys[30], // 0x2b
+		[0x2c] = &scan_code_set_2_keys[31], // 0x2c
+		[0x2d] = &scan_code_set_2_keys[32], // 0x2d
+		[0x2e] = &scan_code_set_2_keys[33], // 0x2e
+		[0x31] = &scan_code_set_2_keys[34], // 0x31
+		[0x32] = &scan_code_set_2_keys[35], // 0x32
+		[0x33] = &scan_code_set_2_keys[36], // 0x33
+		[0x34] = &scan_code_set_2_keys[37], // 0x34
+		[0x35] = &scan_code_set_2_keys[38], // 0x35
+		[0x36] = &scan_code_set_2_keys[39], // 0x36
+		[0x3a] = &scan_code_set_2_keys[40], // 0x3a
+		[0x3b] = &scan_code_set_2_keys[41], // 0x3b
+		[0x3c] = &scan_code_set_2_keys[42], // 0x3c
+		[0x3d] = &scan_code_set_2_keys[43], // 0x3d
+		[0x3e] = &scan_code_set_2_keys[44], // 0x3e
+		[0x41] = &scan_code_set_2_keys[45], // 0x41
+		[0x42] = &scan_code_set_2_keys[46], // 0x42
+		[0x43] = &scan_code_set_2_keys[47], // 0x43
+		[0x44] = &scan_code_set_2_keys[48], // 0x44
+		[0x45] = &scan_code_set_2_keys[49], // 0x45
+		[0x46] = &scan_code_set_2_keys[50], // 0x46
+		[0x49] = &scan_code_set_2_keys[51], // 0x49
+		[0x4a] = &scan_code_set_2_keys[52], // 0x4a
+		[0x4b] = &scan_code_set_2_keys[53], // 0x4b
+		[0x4c] = &scan_code_set_2_keys[54], // 0x4c
+		[0x4d] = &scan_code_set_2_keys[55], // 0x4d
+		[0x4e] = &scan_code_set_2_keys[56], // 0x4e
+		[0x52] = &scan_code_set_2_keys[57], // 0x52
+		[0x54] = &scan_code_set_2_keys[58], // 0x54
+		[0x55] = &scan_code_set_2_keys[59], // 0x55
+		[0x58] = &scan_code_set_2_keys[60], // 0x58
+		[0x59] = &scan_code_set_2_keys[61], // 0x59
+		[0x5a] = &scan_code_set_2_keys[62], // 0x5a
+		[0x5b] = &scan_code_set_2_keys[63], // 0x5b
+		[0x5d] = &scan_code_set_2_keys[64], // 0x5d
+		[0x66] = &scan_code_set_2_keys[65], // 0x66
+		[0x69] = &scan_code_set_2_keys[66], // 0x69
+		[0x6b] = &scan_code_set_2_keys[67], // 0x6b
+		[0x6c] = &scan_code_set_2_keys[68], // 0x6c
+		[0x70] = &scan_code_set_2_keys[69], // 0x70
+		[0x71] = &scan_code_set_2_keys[70], // 0x71
+		[0x72] = &scan_code_set_2_keys[71], // 0x72
+		[0x73] = &scan_code_set_2_keys[72], // 0x73
+		[0x74] = &scan_code_set_2_keys[73], // 0x74
+		[0x75] = &scan_code_set_2_keys[74], // 0x75
+		[0x76] = &scan_code_set_2_keys[75], // 0x76
+		[0x77] = &scan_code_set_2_keys[76], // 0x77
+		[0x78] = &scan_code_set_2_keys[77], // 0x78
+		[0x79] = &scan_code_set_2_keys[78], // 0x79
+		[0x7a] = &scan_code_set_2_keys[79], // 0x7a
+		[0x7b] = &scan_code_set_2_keys[80], // 0x7b
+		[0x7c] = &scan_code_set_2_keys[81], // 0x7c
+		[0x7d] = &scan_code_set_2_keys[82], // 0x7d
+		[0x7e] = &scan_code_set_2_keys[83], // 0x7e
+		[0x83] = &scan_code_set_2_keys[84], // 0x83
+	},
+	.extended = {
+		{
+		[0x10] = &scan_code_set_2_keys[85], // 0xe010
+		[0x11] = &scan_code_set_2_keys[86], // 0xe011
+		[0x14] = &scan_code_set_2_keys[87], // 0xe014
+		[0x15] = &scan_code_set_2_keys[88], // 0xe015
+		[0x18] = &scan_code_set_2_keys[89], // 0xe018
+		[0x1f] = &scan_code_set_2_keys[90], // 0xe01f
+		[0x20] = &scan_code_set_2_keys[91], // 0xe020
+		[0x21] = &scan_code_set_2_keys[92], // 0xe021
+		[0x23] = &scan_code_set_2_keys[93], // 0xe023
+		[0x27] = &scan_code_set_2_keys[94], // 0xe027
+		[0x28] = &scan_code_set_2_keys[95], // 0xe028
+		[0x2b] = &scan_code_set_2_keys[96], // 0xe02b
+		[0x2f] = &scan_code_set_2_keys[97], // 0xe02f
+		[0x30] = &scan_code_set_2_keys[98], // 0xe030
+		[0x32] = &scan_code_set_2_keys[99], // 0xe032
+		[0x34] = &scan_code_set_2_keys[100], // 0xe034
+		[0x37] = &scan_code_set_2_keys[101], // 0xe037
+		[0x38] = &scan_code_set_2_keys[102], // 0xe038
+		[0x3a] = &scan_code_set_2_keys[103], // 0xe03a
+		[0x3b] = &scan_code_set_2_keys[104], // 0xe03b
+		[0x3f] = &scan_code_set_2_keys[105], // 0xe03f
+		[0x40] = &scan_code_set_2_keys[106], // 0xe040
+		[0x48] = &scan_code_set_2_keys[107], // 0xe048
+		[0x4a] = &scan_code_set_2_keys[108], // 0xe04a
+		[0x4d] = &scan_code_set_2_keys[109], // 0xe04d
+		[0x50] = &scan_code_set_2_keys[110], // 0xe050
+		[0x5a] = &scan_code_set_2_keys[111], // 0xe05a
+		[0x5e] = &scan_code_set_2_keys[112], // 0xe05e
+		[0x69] = &scan_code_set_2_keys[113], // 0xe069
+		[0x6b] = &scan_code_set_2_keys[114], // 0xe06b
+		[0x6c] = &scan_code_set_2_keys[115], // 0xe06c
+		[0x70] = &scan_code_set_2_keys[116], // 0xe070
+		[0x71] = &scan_code_set_2_keys[117], // 0xe071
+		[0x72] = &scan_code_set_2_keys[118], // 0xe072
+		[0x74] = &scan_code_set_2_keys[119], // 0xe074
+		[0x75] = &scan_code_set_2_keys[120], // 0xe075
+		[0x7a] = &scan_code_set_2_keys[121], // 0xe07a
+		[0x7d] = &scan_code_set_2_keys[122], // 0xe07d
+		},
+		{
+		},
+	},
+	.long_codes = {
+		&scan_code_set_2_keys[123], // 0xe012e07c
+		&scan_code_set_2_keys[124], // 0xe07ce012
+		&scan_code_set_2_keys[125], // 0xe11477e1f014f077
+	},
+	.long_codes_len = 3,
+};
+
+static const struct scan_code_automaton	scan_code_set_2_automaton = {
+	.transitions = {
+		[0] = {
+			[0x1] = SCAN_CODE_TRANSITION_ACCEPT | 0,
+			[0x3] = SCAN_CODE_TRANSITION_ACCEPT | 1,
+			[0x4] = SCAN_CODE_TRANSITION_ACCEPT | 2,
+			[0x5] = SCAN_CODE_TRANSITION_ACCEPT | 3,
+			[0x6] = SCAN_CODE_TRANSITION_ACCEPT | 4,
+			[0x7] = SCAN_CODE_TRANSITION_ACCEPT | 5,
+			[0x9] = SCAN_CODE_TRANSITION_ACCEPT | 6,
+			[0xa] = SCAN_CODE_TRANSITION_ACCEPT | 7,
+			[0xb] = SCAN_CODE_TRANSITION_ACCEPT | 8,
+			[0xc] = SCAN_CODE_TRANSITION_ACCEPT | 9,
+			[0xd] = SCAN_CODE_TRANSITION_ACCEPT | 10,
+			[0xe] = SCAN_CODE_TRANSITION_ACCEPT | 11,
+			[0x11] = SCAN_CODE_TRANSITION_ACCEPT | 12,
+			[0x12] = SCAN_CODE_TRANSITION_ACCEPT | 13,
+			[0x14] = SCAN_CODE_TRANSITION_ACCEPT | 14,
+			[0x15] = SCAN_CODE_TRANSITION_ACCEPT | 15,
+			[0x16] = SCAN_CODE_TRANSITION_ACCEPT | 16,
+			[0x1a] = SCAN_CODE_TRANSITION_ACCEPT | 17,
+			[0x1b] = SCAN_CODE_TRANSITION_ACCEPT | 18,
+			[0x1c] = SCAN_CODE_TRANSITION_ACCEPT | 19,
+			[0x1d] = SCAN_CODE_TRANSITION_ACCEPT | 20,
+			[0x1e] = SCAN_CODE_TRANSITION_ACCEPT | 21,
+			[0x21] = SCAN_CODE_TRANSITION_ACCEPT | 22,
+			[0x22] = SCAN_CODE_TRANSITION_ACCEPT | 23,
+			[0x23] = SCAN_CODE_TRANSITION_ACCEPT | 24,
+			[0x24] = SCAN_CODE_TRANSITION_ACCEPT | 25,
+			[0x25] = SCAN_CODE_TRANSITION_ACCEPT | 26,
+			[0x26] = SCAN_CODE_TRANSITION_ACCEPT | 27,
+			[0x29] = SCAN_CODE_TRANSITION_ACCEPT | 28,
+			[0x2a] = SCAN_CODE_TRANSITION_ACCEPT | 29,
+			[0x2b] = SCAN_CODE_TRANSITION_ACCEPT | 30,
+			[0x2c] = SCAN_CODE_TRANSITION_ACCEPT | 31,
+			[0x2d] = SCAN_CODE_TRANSITION_ACCEPT | 32,
+			[0x2e] = SCAN_CODE_TRANSITION_ACCEPT | 33,
+			[0x31] = SCAN_CODE_TRANSITION_ACCEPT | 34,
+			[0x32] = SCAN_CODE_TRANSITION_ACCEPT | 35,
+			[0x33] = SCAN_CODE_TRANSITION_ACCEPT | 36,
+			[0x34] = SCAN_CODE_TRANSITION_ACCEPT | 37,
+			[0x35] = SCAN_CODE_TRANSITION_ACCEPT | 38,
+			[0x36] = SCAN_CODE_TRANSITION_ACCEPT | 39,
+			[0x3a] = SCAN_CODE_TRANSITION_ACCEPT | 40,
+			[0x3b] = SCAN_CODE_TRANSITION_ACCEPT | 41,
+			[0x3c] = SCAN_CODE_TRANSITION_ACCEPT | 42,
+			[0x3d] = SCAN_CODE_TRANSITION_ACCEPT | 43,
+			[0x3e] = SCAN_CODE_TRANSITION_ACCEPT | 44,
+			[0x41] = SCAN_CODE_TRANSITION_ACCEPT | 45,
+			[0x42] = SCAN_CODE_TRANSITION_ACCEPT | 46,
+			[0x43] = SCAN_CODE_TRANSITION_ACCEPT | 47,
+			[0x44] = SCAN_CODE_TRANSITION_ACCEPT | 48,
+			[0x45] = SCAN_CODE_TRANSITION_ACCEPT | 49,
+			[0x46] = SCAN_CODE_TRANSITION_ACCEPT | 50,
+			[0x49] = SCAN_CODE_TRANSITION_ACCEPT | 51,
+			[0x4a] = SCAN_CODE_TRANSITION_ACCEPT | 52,
+			[0x4b] = SCAN_CODE_TRANSITION_ACCEPT | 53,
+			[0x4c] = SCAN_CODE_TRANSITION_ACCEPT | 54,
+			[0x4d] = SCAN_CODE_TRANSITION_ACCEPT | 55,
+			[0x4e] = SCAN_CODE_TRANSITION_ACCEPT | 56,
+			[0x52] = SCAN_CODE_TRANSITION_ACCEPT | 57,
+			[0x54] = SCAN_CODE_TRANSITION_ACCEPT | 58,
+			[0x55] = SCAN_CODE_TRANSITION_ACCEPT | 59,
+			[0x58] = SCAN_CODE_TRANSITION_ACCEPT | 60,
+			[0x59] = SCAN_CODE_TRANSITION_ACCEPT | 61,
+			[0x5a] = SCAN_CODE_TRANSITION_ACCEPT | 62,
+			[0x5b] = SCAN_CODE_TRANSITION_ACCEPT | 63,
+			[0x5d] = SCAN_CODE_TRANSITION_ACCEPT | 64,
+			[0x66] = SCAN_CODE_TRANSITION_ACCEPT | 65,
+			[0x69] = SCAN_CODE_TRANSITION_ACCEPT | 66,
+			[0x6b] = SCAN_CODE_TRANSITION_ACCEPT | 67,
+			[0x6c] = SCAN_CODE_TRANSITION_ACCEPT | 68,
+			[0x70] = SCAN_CODE_TRANSITION_ACCEPT | 69,
+			[0x71] = SCAN_CODE_TRANSITION_ACCEPT | 70,
+			[0x72] = SCAN_CODE_TRANSITION_ACCEPT | 71,
+			[0x73] = SCAN_CODE_TRANSITION_ACCEPT | 72,
+			[0x74] = SCAN_CODE_TRANSITION_ACCEPT | 73,
+			[0x75] = SCAN_CODE_TRANSITION_ACCEPT | 74,
+			[0x76] = SCAN_CODE_TRANSITION_ACCEPT | 75,
+			[0x77] = SCAN_CODE_TRANSITION_ACCEPT | 76,
+			[0x78] = SCAN_CODE_TRANSITION_ACCEPT | 77,
+			[0x79] = SCAN_CODE_TRANSITION_ACCEPT | 78,
+			[0x7a] = SCAN_CODE_TRANSITION_ACCEPT | 79,
+			[0x7b] = SCAN_CODE_TRANSITION_ACCEPT | 80,
+			[0x7c] = SCAN_CODE_TRANSITION_ACCEPT | 81,
+			[0x7d] = SCAN_CODE_TRANSITION_ACCEPT | 82,
+			[0x7e] = SCAN_CODE_TRANSITION_ACCEPT | 83,
+			[0x83] = SCAN_CODE_TRANSITION_ACCEPT | 84,
+			[0xe0] = 1,
+			[0xe1] = 6,
+		},
+		[1] = {
+			[0x10] = SCAN_CODE_TRANSITION_ACCEPT | 85,
+			[0x11] = SCAN_CODE_TRANSITION_ACCEPT | 86,
+			[0x12] = 2,
+			[0x14] = SCAN_CODE_TRANSITION_ACCEPT | 87,
+			[0x15] = SCAN_CODE_TRANSITION_ACCEPT | 88,
+			[0x18] = SCAN_CODE_TRANSITION_ACCEPT | 89,
+			[0x1f] = SCAN_CODE_TRANSITION_ACCEPT | 90,
+			[0x20] = SCAN_CODE_TRANSITION_ACCEPT | 91,
+			[0x21] = SCAN_CODE_TRANSITION_ACCEPT | 92,
+			[0x23] = SCAN_CODE_TRANSITION_ACCEPT | 93,
+			[0x27] = SCAN_CODE_TRANSITION_ACCEPT | 94,
+			[0x28] = SCAN_CODE_TRANSITION_ACCEPT | 95,
+			[0x2b] = SCAN_CODE_TRANSITION_ACCEPT | 96,
+			[0x2f] = SCAN_CODE_TRANSITION_ACCEPT | 97,
+			[0x30] = SCAN_CODE_TRANSITION_ACCEPT | 98,
+			[0x32] = SCAN_CODE_TRANSITION_ACCEPT | 99,
+			[0x34] = SCAN_CODE_TRANSITION_ACCEPT | 100,
+			[0x37] = SCAN_CODE_TRANSITION_ACCEPT | 101,
+			[0x38] = SCAN_CODE_TRANSITION_ACCEPT | 102,
+			[0x3a] = SCAN_CODE_TRANSITION_ACCEPT | 103,
+			[0x3b] = SCAN_CODE_TRANSITION_ACCEPT | 104,
+			[0x3f] = SCAN_CODE_TRANSITION_ACCEPT | 105,
+			[0x40] = SCAN_CODE_TRANSITION_ACCEPT | 106,
+			[0x48] = SCAN_CODE_TRANSITION_ACCEPT | 107,
+			[0x4a] = SCAN_CODE_TRANSITION_ACCEPT | 108,
+			[0x4d] = SCAN_CODE_TRANSITION_ACCEPT | 109,
+			[0x50] = SCAN_CODE_TRANSITION_ACCEPT | 110,
+			[0x5a] = SCAN_CODE_TRANSITION_ACCEPT | 111,
+			[0x5e] = SCAN_CODE_TRANSITION_ACCEPT | 112,
+			[0x69] = SCAN_CODE_TRANSITION_ACCEPT | 113,
+			[0x6b] = SCAN_CODE_TRANSITION_ACCEPT | 114,
+			[0x6c] = SCAN_CODE_TRANSITION_ACCEPT | 115,
+			[0x70] = SCAN_CODE_TRANSITION_ACCEPT | 116,
+			[0x71] = SCAN_CODE_TRANSITION_ACCEPT | 117,
+			[0x72] = SCAN_CODE_TRANSITION_ACCEPT | 118,
+			[0x74] = SCAN_CODE_TRANSITION_ACCEPT | 119,
+			[0x75] = SCAN_CODE_TRANSITION_ACCEPT | 120,
+			[0x7a] = SCAN_CODE_TRANSITION_ACCEPT | 121,
+			[0x7c] = 4,
+			[0x7d] = SCAN_CODE_TRANSITION_ACCEPT | 122,
+		},
+		[2] = {
+			[0xe0] = 3,
+		},
+		[3] = {
+			[0x7c] = SCAN_CODE_TRANSITION_ACCEPT | 123,
+		},
+		[4] = {
+			[0xe0] = 5,
+		},
+		[5] = {
+			[0x12] = SCAN_CODE_TRANSITION_ACCEPT | 124,
+		},
+		[6] = {
+			[0x14] = 7,
+		},
+		[7] = {
+			[0x77] = 8,
+		},
+		[8] = {
+			[0xe1] = 9,
+		},
+		[9] = {
+			[0xf0] = 10,
+		},
+		[10] = {
+			[0x14] = 11,
+		},
+		[11] = {
+			[0xf0] = 12,
+		},
+		[12] = {
+			[0x77] = SCAN_CODE_TRANSITION_ACCEPT | 125,
+		},
+	},
+	.states_len = 13,
+};
+
+const struct scan_code_set	scan_code_set_2 = {
+	.keys = scan_code_set_2_keys,
+	.len = sizeof(scan_code_set_2_keys) / sizeof(*scan_code_set_2_keys),
+	.index = &scan_code_set_2_index,
+	.automaton = &scan_code_set_2_automaton,
+	.break_prefix = 0xf0,
+};
+
+static const struct scan_key_code	scan_code_set_3_keys[] = {
+	{ 0x7, scan_code_names + 226, PRESSED, 0x0, PS2_MODIFIER_NONE, 58 }, // 0: "F1"
+	{ 0x8, scan_code_names + 0, PRESSED, 0x0, PS2_MODIFIER_ESCAPE, 0 }, // 1: "escape"
+	{ 0xd, scan_code_names + 48, PRESSED, '\t', PS2_MODIFIER_NONE, 14 }, // 2: "tab"
+	{ 0xe, scan_code_names + 132, PRESSED, '`', PS2_MODIFIER_NONE, 40 }, // 3: "` (back tick)"
+	{ 0xf, scan_code_names + 229, PRESSED, 0x0, PS2_MODIFIER_NONE, 59 }, // 4: "F2"
+	{ 0x11, scan_code_names + 82, PRESSED, 0x0, PS2_MODIFIER_LEFT_CONTROL, 28 }, // 5: "left control"
+	{ 0x12, scan_code_names + 146, PRESSED, 0x0, PS2_MODIFIER_LEFT_SHIFT, 41 }, // 6: "left shift"
+	{ 0x14, scan_code_names + 217, PRESSED, 0x0, PS2_MODIFIER_CAPSLOCK, 57 }, // 7: "CapsLock"
+	{ 0x15, scan_code_names + 52, PRESSED, 'q', PS2_MODIFIER_NONE, 15 }, // 8: "Q"
+	{ 0x16, scan_code_names + 7, PRESSED, '1', PS2_MODIFIER_NONE, 1 }, // 9: "1"
+	{ 0x17, scan_code_names + 232, PRESSED, 0x0, PS2_MODIFIER_NONE, 60 }, // 10: "F3"
+	{ 0x19, scan_code_names + 202, PRESSED, 0x0, PS2_MODIFIER_LEFT_ALT, 55 }, // 11: "left alt"
+	{ 0x1a, scan_code_names + 159, PRESSED, 'z', PS2_MODIFIER_NONE, 43 }, // 12: "Z"
+	{ 0x1b, scan_code_names + 97, PRESSED, 's', PS2_MODIFIER_NONE, 30 }, // 13: "S"
+	{ 0x1c, scan_code_names + 95, PRESSED, 'a', PS2_MODIFIER_NONE, 29 }, // 14: "A"
+	{ 0x1d, scan_code_names + 54, PRESSED, 'w', PS2_MODIFIER_NONE, 16 }, // 15: "W"
+	{ 0x1e, scan_code_names + 9, PRESSED, '2', PS2_MODIFIER_NONE, 2 }, // 16: "2"
+	{ 0x1f, scan_code_names + 235, PRESSED, 0x0, PS2_MODIFIER_NONE, 61 }, // 17: "F4"
+	{ 0x21, scan_code_names + 163, PRESSED, 'c', PS2_MODIFIER_NONE, 45 }, // 18: "C"
+	{ 0x22, scan_code_names + 161, PRESSED, 'x', PS2_MODIFIER_NONE, 44 }, // 19: "X"
+	{ 0x23, scan_code_names + 99, PRESSED, 'd', PS2_MODIFIER_NONE, 31 }, // 20: "D"
+	{ 0x24, scan_code_names + 56, PRESSED, 'e', PS2_MODIFIER_NONE, 17 }, // 21: "E"
+	{ 0x25, scan_code_names + 13, PRESSED, '4', PS2_MODIFIER_NONE, 4 }, // 22: "4"
+	{ 0x26, scan_code_names + 11, PRESSED, '3', PS2_MODIFIER_NONE, 3 }, // 23: "3"
+	{ 0x27, scan_code_names + 238, PRESSED, 0x0, PS2_MODIFIER_NONE, 62 }, // 24: "F5"
+	{ 0x29, scan_code_names + 211, PRESSED, ' ', PS2_MODIFIER_NONE, 56 }, // 25: "space"
+	{ 0x2a, scan_code_names + 165, PRESSED, 'v', PS2_MODIFIER_NONE, 46 }, // 26: "V"
+	{ 0x2b, scan_code_names + 101, PRESSED, 'f', PS2_MODIFIER_NONE, 32 }, // 27: "F"
+	{ 0x2c, scan_code_names + 60, PRESSED, 't', PS2_MODIFIER_NONE, 19 }, // 28: "T"
+	{ 0x2d, scan_code_names + 58, PRESSED, 'r', PS2_MODIFIER_NONE, 18 }, // 29: "R"
+	{ 0x2e, scan_code_names + 15, PRESSED, '5', PS2_MODIFIER_NONE, 5 }, // 30: "5"
+	{ 0x2f, scan_code_names + 241, PRESSED, 0x0, PS2_MODIFIER_NONE, 63 }, // 31: "F6"
+	{ 0x31, scan_code_names + 169, PRESSED, 'n', PS2_MODIFIER_NONE, 48 }, // 32: "N"
+	{ 0x32, scan_code_names + 167, PRESSED, 'b', PS2_MODIFIER_NONE, 47 }, // 33: "B"
+	{ 0x33, scan_code_names + 105, PRESSED, 'h', PS2_MODIFIER_NONE, 34 }, // 34: "H"
+	{ 0x34, scan_code_names + 103, PRESSED, 'g', PS2_MODIFIER_NONE, 33 }, // 35: "G"
+	{ 0x35, scan_code_names + 62, PRESSED, 'y', PS2_MODIFIER_NONE, 20 }, // 36: "Y"
+	{ 0x36, scan_code_names + 17, PRESSED, '6', PS2_MODIFIER_NONE, 6 }, // 37: "6"
+	{ 0x37, scan_code_names + 244, PRESSED, 0x0, PS2_MODIFIER_NONE, 64 }, // 38: "F7"
+	{ 0x39, scan_code_names + 670, PRESSED, 0x0, PS2_MODIFIER_RIGHT_ALT, 97 }, // 39: "right alt (or altGr)"
+	{ 0x3a, scan_code_names + 171, PRESSED, 'm', PS2_MODIFIER_NONE, 49 }, // 40: "M"
+	{ 0x3b, scan_code_names + 107, PRESSED, 'j', PS2_MODIFIER_NONE, 35 }, // 41: "J"
+	{ 0x3c, scan_code_names + 64, PRESSED, 'u', PS2_MODIFIER_NONE, 21 }, // 42: "U"
+	{ 0x3d, scan_code_names + 19, PRESSED, '7', PS2_MODIFIER_NONE, 7 }, // 43: "7"
+	{ 0x3e, scan_code_names + 21, PRESSED, '8', PS2_MODIFIER_NONE, 8 }, // 44: "8"
+	{ 0x3f, scan_code_names + 247, PRESSED, 0x0, PS2_MODIFIER_NONE, 65 }, // 45: "F8"
+	{ 0x41, scan_code_names + 173, PRESSED, ',', PS2_MODIFIER_NONE, 50 }, // 46: ","
+	{ 0x42, scan_code_names + 109, PRESSED, 'k', PS2_MODIFIER_NONE, 36 }, // 47: "K"
+	{ 0x43, scan_code_names + 66, PRESSED, 'i', PS2_MODIFIER_NONE, 22 }, // 48: "I"
+	{ 0x44, scan_code_names + 68, PRESSED, 'o', PS2_MODIFIER_NONE, 23 }, // 49: "O"
+	{ 0x45, scan_code_names + 25, PRESSED, '0', PS2_MODIFIER_NONE, 10 }, // 50: "0 (zero)"
+	{ 0x46, scan_code_names + 23, PRESSED, '9', PS2_MODIFIER_NONE, 9 }, // 51: "9"
+	{ 0x47, scan_code_names + 250, PRESSED, 0x0, PS2_MODIFIER_NONE, 66 }, // 52: "F9"
+	{ 0x49, scan_code_names + 175, PRESSED, '.', PS2_MODIFIER_NONE, 51 }, // 53: "."
+	{ 0x4a, scan_code_names + 177, PRESSED, '/', PS2_MODIFIER_NONE, 52 }, // 54: "/"
+	{ 0x4b, scan_code_names + 111, PRESSED, 'l', PS2_MODIFIER_NONE, 37 }, // 55: "L"
+	{ 0x4c, scan_code_names + 113, PRESSED, ';', PS2_MODIFIER_NONE, 38 }, // 56: ";"
+	{ 0x4d, scan_code_names + 70, PRESSED, 'p', PS2_MODIFIER_NONE, 24 }, // 57: "P"
+	{ 0x4e, scan_code_names + 34, PRESSED, '-', PS2_MODIFIER_NONE, 11 }, // 58: "-"
+	{ 0x4f, scan_code_names + 253, PRESSED, 0x0, PS2_MODIFIER_NONE, 67 }, // 59: "F10"
+	{ 0x52, scan_code_names + 115, PRESSED, '\'', PS2_MODIFIER_NONE, 39 }, // 60: "' (single quote)"
+	{ 0x54, scan_code_names + 72, PRESSED, '[', PS2_MODIFIER_NONE, 25 }, // 61: "["
+	{ 0x55, scan_code_names + 36, PRESSED, '=', PS2_MODIFIER_NONE, 12 }, // 62: "="
+	{ 0x56, scan_code_names + 422, PRESSED, 0x0, PS2_MODIFIER_NONE, 83 }, // 63: "F11"
+	{ 0x57, scan_code_names + 1058, PRESSED, 0x0, PS2_MODIFIER_NONE, 123 }, // 64: "print screen"
+	{ 0x58, scan_code_names + 497, PRESSED, 0x0, PS2_MODIFIER_RIGHT_CONTROL, 88 }, // 65: "right control"
+	{ 0x59, scan_code_names + 179, PRESSED, 0x0, PS2_MODIFIER_RIGHT_SHIFT, 53 }, // 66: "right shift"
+	{ 0x5a, scan_code_names + 76, PRESSED, '\n', PS2_MODIFIER_NONE, 27 }, // 67: "enter"
+	{ 0x5b, scan_code_names + 74, PRESSED, ']', PS2_MODIFIER_NONE, 26 }, // 68: "]"
+	{ 0x5c, scan_code_names + 157, PRESSED, '\\', PS2_MODIFIER_NONE, 42 }, // 69: "\\"
+	{ 0x5e, scan_code_names + 426, PRESSED, 0x0, PS2_MODIFIER_NONE, 84 }, // 70: "F12"
+	{ 0x5f, scan_code_names + 268, PRESSED, 0x0, PS2_MODIFIER_SCROLL_LOCK, 69 }, // 71: "ScrollLock"
+	{ 0x60, scan_code_names + 743, PRESSED, 0x0, PS2_MODIFIER_NONE, 104 }, // 72: "cursor down"
+	{ 0x61, scan_code_names + 714, PRESSED, 0x0, PS2_MODIFIER_NONE, 101 }, // 73: "cursor left"
+	{ 0x62, scan_code_names + 1071, PRESSED, 0x0, PS2_MODIFIER_NONE, 124 }, // 74: "pause"
+	{ 0x63, scan_code_names + 696, PRESSED, 0x0, PS2_MODIFIER_NONE, 99 }, // 75: "cursor up"
+	{ 0x64, scan_code_names + 772, PRESSED, 0x0, PS2_MODIFIER_NONE, 107 }, // 76: "delete"
+	{ 0x65, scan_code_names + 739, PRESSED, 0x0, PS2_MODIFIER_NONE, 103 }, // 77: "end"
+	{ 0x66, scan_code_names + 38, PRESSED, 0x0, PS2_MODIFIER_NONE, 13 }, // 78: "backspace"
+	{ 0x67, scan_code_names + 765, PRESSED, 0x0, PS2_MODIFIER_NONE, 106 }, // 79: "insert"
+	{ 0x69, scan_code_names + 367, PRESSED, '1', PS2_MODIFIER_NONE, 78 }, // 80: "(keypad) 1"
+	{ 0x6a, scan_code_names + 726, PRESSED, 0x0, PS2_MODIFIER_NONE, 102 }, // 81: "cursor right"
+	{ 0x6b, scan_code_names + 323, PRESSED, '4', PS2_MODIFIER_NONE, 74 }, // 82: "(keypad) 4"
+	{ 0x6c, scan_code_names + 279, PRESSED, '7', PS2_MODIFIER_NONE, 70 }, // 83: "(keypad) 7"
+	{ 0x6d, scan_code_names + 755, PRESSED, 0x0, PS2_MODIFIER_NONE, 105 }, // 84: "page down"
+	{ 0x6e, scan_code_names + 691, PRESSED, 0x0, PS2_MODIFIER_NONE, 98 }, // 85: "home"
+	{ 0x6f, scan_code_names + 706, PRESSED, 0x0, PS2_MODIFIER_NONE, 100 }, // 86: "page up"
+	{ 0x70, scan_code_names + 400, PRESSED, '0', PS2_MODIFIER_NONE, 81 }, // 87: "(keypad) 0"
+	{ 0x71, scan_code_names + 411, PRESSED, '.', PS2_MODIFIER_NONE, 82 }, // 88: "(keypad) ."
+	{ 0x72, scan_code_names + 378, PRESSED, '2', PS2_MODIFIER_NONE, 79 }, // 89: "(keypad) 2"
+	{ 0x73, scan_code_names + 334, PRESSED, '5', PS2_MODIFIER_NONE, 75 }, // 90: "(keypad) 5"
+	{ 0x74, scan_code_names + 345, PRESSED, '6', PS2_MODIFIER_NONE, 76 }, // 91: "(keypad) 6"
+	{ 0x75, scan_code_names + 290, PRESSED, '8', PS2_MODIFIER_NONE, 71 }, // 92: "(keypad) 8"
+	{ 0x76, scan_code_names + 257, PRESSED, 0x0, PS2_MODIFIER_NUMBER_LOCK, 68 }, // 93: "NumberLock"
+	{ 0x77, scan_code_names + 659, PRESSED, '/', PS2_MODIFIER_NONE, 96 }, // 94: "(keypad) /"
+	{ 0x79, scan_code_names + 482, PRESSED, '\n', PS2_MODIFIER_NONE, 87 }, // 95: "(keypad) enter"
+	{ 0x7a, scan_code_names + 389, PRESSED, '3', PS2_MODIFIER_NONE, 80 }, // 96: "(keypad) 3"
+	{ 0x7c, scan_code_names + 356, PRESSED, '+', PS2_MODIFIER_NONE, 77 }, // 97: "(keypad) +"
+	{ 0x7d, scan_code_names + 301, PRESSED, '9', PS2_MODIFIER_NONE, 72 }, // 98: "(keypad) 9"
+	{ 0x7e, scan_code_names + 191, PRESSED, '*', PS2_MODIFIER_NONE, 54 }, // 99: "(keypad) *"
+	{ 0x84, scan_code_names + 312, PRESSED, '-', PS2_MODIFIER_NONE, 73 }, // 100: "(keypad) -"
+	{ 0x8b, scan_code_names + 779, PRESSED, 0x0, PS2_MODIFIER_NONE, 108 }, // 101: "left GUI"
+	{ 0x8c, scan_code_names + 788, PRESSED, 0x0, PS2_MODIFIER_NONE, 109 }, // 102: "right GUI"
+	{ 0x8d, scan_code_names + 798, PRESSED, 0x0, PS2_MODIFIER_NONE, 110 }, // 103: "\"apps\""
+};
+
+static const struct scan_code_index	scan_code_set_3_index = {
+	.single = {
+		[0x7] = &scan_code_set_3_keys[0], // 0x7
+		[0x8] = &scan_code_set_3_keys[1], // 0x8
+		[0xd] = &scan_code_set_3_keys[2], // 0xd
+		[0xe] = &scan_code_set_3_keys[3], // 0xe
+		[0xf] = &scan_code_set_3_keys[4], // 0xf
+		[0x11] = &scan_code_set_3_keys[5], // 0x11
+		[0x12] = &scan_code_set_3_keys[6], // 0x12
+		[0x14] = &scan_code_set_3_keys[7], // 0x14
+		[0x15] = &scan_code_set_3_keys[8], // 0x15
+		[0x16] = &scan_code_set_3_keys[9], // 0x16
+		[0x17] = &scan_code_set_3_keys[10], // 0x17
+		[0x19] = &scan_code_set_3_keys[11], // 0x19
+		[0x1a] = &scan_code_set_3_keys[12], // 0x1a
+		[0x1b] = &scan_code_set_3_keys[13], // 0x1b
+		[0x1c] = &scan_code_set_3_keys[14], // 0x1c
+		[0x1d] = &scan_code_set_3_keys[15], // 0x1d
+		[0x1e] = &scan_code_set_3_keys[16], // 0x1e
+		[0x1f] = &scan_code_set_3_keys[17], // 0x1f
+		[0x21] = &scan_code_set_3_keys[18], // 0x21
+		[0x22] = &scan_code_set_3_keys[19], // 0x22
+		[0x23] = &scan_code_set_3_keys[20], // 0x23
+		[0x24] = &scan_code_set_3_keys[21], // 0x24
+		[0x25] = &scan_code_set_3_keys[22], // 0x25
+		[0x26] = &scan_code_set_3_keys[23], // 0x26
+		[0x27] = &scan_code_set_3_keys[24], // 0x27
+		[0x29] = &scan_code_set_3_keys[25], // 0x29
+		[0x2a] = &scan_code_set_3_keys[26], // 0x2a
+		[0x2b] = &scan_code_set_3_keys[27], // 0x2b
+		[0x2c] = &scan_code_set_3_keys[28], // 0x2c
+		[0x2d] = &scan_code_set_3_keys[29], // 0x2d
+		[0x2e] = &scan_code_set_3_keys[30], // 0x2e
+		[0x2f] = &scan_code_set_3_keys[31], // 0x2f
+		[0x31] = &scan_code_set_3_keys[32], // 0x31
+		[0x32] = &scan_code_set_3_keys[33], // 0x32
+		[0x33] = &scan_code_set_3_keys[34], // 0x33
+		[0x34] = &scan_code_set_3_keys[35], // 0x34
+		[0x35] = &scan_code_set_3_keys[36], // 0x35
+		[0x36] = &scan_code_set_3_keys[37], // 0x36
+		[0x37] = &scan_code_set_3_keys[38], // 0x37
+		[0x39] = &scan_code_set_3_keys[39], // 0x39
+		[0x3a] = &scan_code_set_3_keys[40], // 0x3a
+		[0x3b] = &scan_code_set_3_keys[41], // 0x3b
+		[0x3c] = &scan_code_set_3_keys[42], // 0x3c
+		[0x3d] = &scan_code_set_3_keys[43], // 0x3d
+		[0x3e] = &scan_code_set_3_keys[44], // 0x3e
+		[0x3f] = &scan_code_set_3_keys[45], // 0x3f
+		[0x41] = &scan_code_set_3_keys[46], // 0x41
+		[0x42] = &scan_code_set_3_keys[47], // 0x42
+		[0x43] = &scan_code_set_3_keys[48], // 0x43
+		[0x44] = &scan_code_set_3_keys[49], // 0x44
+		[0x45] = &scan_code_set_3_keys[50], // 0x45
+		[0x46] = &scan_code_set_3_keys[51], // 0x46
+		[0x47] = &scan_code_set_3_keys[52], // 0x47
+		[0x49] = &scan_code_set_3_keys[53], // 0x49
+		[0x4a] = &scan_code_set_3_keys[54], // 0x4a
+		[0x4b] = &scan_code_set_3_keys[55], // 0x4b
+		[0x4c] = &scan_code_set_3_keys[56], // 0x4c
+		[0x4d] = &scan_code_set_3_keys[57], // 0x4d
+		[0x4e] = &scan_code_set_3_keys[58], // 0x4e
+		[0x4f] = &scan_code_set_3_keys[59], // 0x4f
+		[0x52] = &scan_code_set_3_keys[60], // 0x52
+		[0x54] = &scan_code_set_3_keys[61], // 0x54
+		[0x55] = &scan_code_set_3_keys[62], // 0x55
+		[0x56] = &scan_code_set_3_keys[63], // 0x56
+		[0x57] = &scan_code_set_3_keys[64], // 0x57
+		[0x58] = &scan_code_set_3_keys[65], // 0x58
+		[0x59] = &scan_code_set_3_keys[66], // 0x59
+		[0x5a] = &scan_code_set_3_keys[67], // 0x5a
+		[0x5b] = &scan_code_set_3_keys[68], // 0x5b
+		[0x5c] = &scan_code_set_3_keys[69], // 0x5c
+		[0x5e] = &scan_code_set_3_keys[70], // 0x5e
+		[0x5f] = &scan_code_set_3_keys[71], // 0x5f
+		[0x60] = &scan_code_set_3_keys[72], // 0x60
+		[0x61] = &scan_code_set_3_keys[73], // 0x61
+		[0x62] = &scan_code_set_3_keys[74], // 0x62
+		[0x63] = &scan_code_set_3_keys[75], // 0x63
+		[0x64] = &scan_code_set_3_keys[76], // 0x64
+		[0x65] = &scan_code_set_3_keys[77], // 0x65
+		[0x66] = &scan_code_set_3_keys[78], // 0x66
+		[0x67] = &scan_code_set_3_keys[79], // 0x67
+		[0x69] = &scan_code_set_3_keys[80], // 0x69
+		[0x6a] = &scan_code_set_3_keys[81], // 0x6a
+		[0x6b] = &scan_code_set_3_keys[82], // 0x6b
+		[0x6c] = &scan_code_set_3_keys[83], // 0x6c
+		[0x6d] = &scan_code_set_3_keys[84], // 0x6d
+		[0x6e] = &scan_code_set_3_keys[85], // 0x6e
+		[0x6f] = &scan_code_set_3_keys[86], // 0x6f
+		[0x70] = &scan_code_set_3_keys[87], // 0x70
+		[0x71] = &scan_code_set_3_keys[88], // 0x71
+		[0x72] = &scan_code_set_3_keys[89], // 0x72
+		[0x73] = &scan_code_set_3_keys[90], // 0x73
+		[0x74] = &scan_code_set_3_keys[91], // 0x74
+		[0x75] = &scan_code_set_3_keys[92], // 0x75
+		[0x76] = &scan_code_set_3_keys[93], // 0x76
+		[0x77] = &scan_code_set_3_keys[94], // 0x77
+		[0x79] = &scan_code_set_3_keys[95], // 0x79
+		[0x7a] = &scan_code_set_3_keys[96], // 0x7a
+		[0x7c] = &scan_code_set_3_keys[97], // 0x7c
+		[0x7d] = &scan_code_set_3_keys[98], // 0x7d
+		[0x7e] = &scan_code_set_3_keys[99], // 0x7e
+		[0x84] = &scan_code_set_3_keys[100], // 0x84
+		[0x8b] = &scan_code_set_3_keys[101], // 0x8b
+		[0x8c] = &scan_code_set_3_keys[102], // 0x8c
+		[0x8d] = &scan_code_set_3_keys[103], // 0x8d
+	},
+	.extended = {
+		{
+		},
+		{
+		},
+	},
+	.long_codes = {
+	},
+	.long_codes_len = 0,
+};
+
+static const struct scan_code_automaton	scan_code_set_3_automaton = {
+	.transitions = {
+		[0] = {
+			[0x7] = SCAN_CODE_TRANSITION_ACCEPT | 0,
+			[0x8] = SCAN_CODE_TRANSITION_ACCEPT | 1,
+			[0xd] = SCAN_CODE_TRANSITION_ACCEPT | 2,
+			[0xe] = SCAN_CODE_TRANSITION_ACCEPT | 3,
+			[0xf] = SCAN_CODE_TRANSITION_ACCEPT | 4,
+			[0x11] = SCAN_CODE_TRANSITION_ACCEPT | 5,
+			[0x12] = SCAN_CODE_TRANSITION_ACCEPT | 6,
+			[0x14] = SCAN_CODE_TRANSITION_ACCEPT | 7,
+			[0x15] = SCAN_CODE_TRANSITION_ACCEPT | 8,
+			[0x16] = SCAN_CODE_TRANSITION_ACCEPT | 9,
+			[0x17] = SCAN_CODE_TRANSITION_ACCEPT | 10,
+			[0x19] = SCAN_CODE_TRANSITION_ACCEPT | 11,
+			[0x1a] = SCAN_CODE_TRANSITION_ACCEPT | 12,
+			[0x1b] = SCAN_CODE_TRANSITION_ACCEPT | 13,
+			[0x1c] = SCAN_CODE_TRANSITION_ACCEPT | 14,
+			[0x1d] = SCAN_CODE_TRANSITION_ACCEPT | 15,
+			[0x1e] = SCAN_CODE_TRANSITION_ACCEPT | 16,
+			[0x1f] = SCAN_CODE_TRANSITION_ACCEPT | 17,
+			[0x21] = SCAN_CODE_TRANSITION_ACCEPT | 18,
+			[0x22] = SCAN_CODE_TRANSITION_ACCEPT | 19,
+			[0x23] = SCAN_CODE_TRANSITION_ACCEPT | 20,
+			[0x24] = SCAN_CODE_TRANSITION_ACCEPT | 21,
+			[0x25] = SCAN_CODE_TRANSITION_ACCEPT | 22,
+			[0x26] = SCAN_CODE_TRANSITION_ACCEPT | 23,
+			[0x27] = SCAN_CODE_TRANSITION_ACCEPT | 24,
+			[0x29] = SCAN_CODE_TRANSITION_ACCEPT | 25,
+			[0x2a] = SCAN_CODE_TRANSITION_ACCEPT | 26,
+			[0x2b] = SCAN_CODE_TRANSITION_ACCEPT | 27,
+			[0x2c] = SCAN_CODE_TRANSITION_ACCEPT | 28,
+			[0x2d] = SCAN_CODE_TRANSITION_ACCEPT | 29,
+			[0x2e] = SCAN_CODE_TRANSITION_ACCEPT | 30,
+			[0x2f] = SCAN_CODE_TRANSITION_ACCEPT | 31,
+			[0x31] = SCAN_CODE_TRANSITION_ACCEPT | 32,
+			[0x32] = SCAN_CODE_TRANSITION_ACCEPT | 33,
+			[0x33] = SCAN_CODE_TRANSITION_ACCEPT | 34,
+			[0x34] = SCAN_CODE_TRANSITION_ACCEPT | 35,
+			[0x35] = SCAN_CODE_TRANSITION_ACCEPT | 36,
+			[0x36] = SCAN_CODE_TRANSITION_ACCEPT | 37,
+			[0x37] = SCAN_CODE_TRANSITION_ACCEPT | 38,
+			[0x39] = SCAN_CODE_TRANSITION_ACCEPT | 39,
+			[0x3a] = SCAN_CODE_TRANSITION_ACCEPT | 40,
+			[0x3b] = SCAN_CODE_TRANSITION_ACCEPT | 41,
+			[0x3c] = SCAN_CODE_TRANSITION_ACCEPT | 42,
+			[0x3d] = SCAN_CODE_TRANSITION_ACCEPT | 43,
+			[0x3e] = SCAN_CODE_TRANSITION_ACCEPT | 44,
+			[0x3f] = SCAN_CODE_TRANSITION_ACCEPT | 45,
+			[0x41] = SCAN_CODE_TRANSITION_ACCEPT | 46,
+			[0x42] = SCAN_CODE_TRANSITION_ACCEPT | 47,
+			[0x43] = SCAN_CODE_TRANSITION_ACCEPT | 48,
+			[0x44] = SCAN_CODE_TRANSITION_ACCEPT | 49,
+			[0x45] = SCAN_CODE_TRANSITION_ACCEPT | 50,
+			[0x46] = SCAN_CODE_TRANSITION_ACCEPT | 51,
+			[0x47] = SCAN_CODE_TRANSITION_ACCEPT | 52,
+			[0x49] = SCAN_CODE_TRANSITION_ACCEPT | 53,
+			[0x4a] = SCAN_CODE_TRANSITION_ACCEPT | 54,
+			[0x4b] = SCAN_CODE_TRANSITION_ACCEPT | 55,
+			[0x4c] = SCAN_CODE_TRANSITION_ACCEPT | 56,
+			[0x4d] = SCAN_CODE_TRANSITION_ACCEPT | 57,
+			[0x4e] = SCAN_CODE_TRANSITION_ACCEPT | 58,
+			[0x4f] = SCAN_CODE_TRANSITION_ACCEPT | 59,
+			[0x52] = SCAN_CODE_TRANSITION_ACCEPT | 60,
+			[0x54] = SCAN_CODE_TRANSITION_ACCEPT | 61,
+			[0x55] = SCAN_CODE_TRANSITION_ACCEPT | 62,
+			[0x56] = SCAN_CODE_TRANSITION_ACCEPT | 63,
+			[0x57] = SCAN_CODE_TRANSITION_ACCEPT | 64,
+			[0x58] = SCAN_CODE_TRANSITION_ACCEPT | 65,
+			[0x59] = SCAN_CODE_TRANSITION_ACCEPT | 66,
+			[0x5a] = SCAN_CODE_TRANSITION_ACCEPT | 67,
+			[0x5b] = SCAN_CODE_TRANSITION_ACCEPT | 68,
+			[0x5c] = SCAN_CODE_TRANSITION_ACCEPT | 69,
+			[0x5e] = SCAN_CODE_TRANSITION_ACCEPT | 70,
+			[0x5f] = SCAN_CODE_TRANSITION_ACCEPT | 71,
+			[0x60] = SCAN_CODE_TRANSITION_ACCEPT | 72,
+			[0x61] = SCAN_CODE_TRANSITION_ACCEPT | 73,
+			[0x62] = SCAN_CODE_TRANSITION_ACCEPT | 74,
+			[0x63] = SCAN_CODE_TRANSITION_ACCEPT | 75,
+			[0x64] = SCAN_CODE_TRANSITION_ACCEPT | 76,
+			[0x65] = SCAN_CODE_TRANSITION_ACCEPT | 77,
+			[0x66] = SCAN_CODE_TRANSITION_ACCEPT | 78,
+			[0x67] = SCAN_CODE_TRANSITION_ACCEPT | 79,
+			[0x69] = SCAN_CODE_TRANSITION_ACCEPT | 80,
+			[0x6a] = SCAN_CODE_TRANSITION_ACCEPT | 81,
+			[0x6b] = SCAN_CODE_TRANSITION_ACCEPT | 82,
+			[0x6c] = SCAN_CODE_TRANSITION_ACCEPT | 83,
+			[0x6d] = SCAN_CODE_TRANSITION_ACCEPT | 84,
+			[0x6e] = SCAN_CODE_TRANSITION_ACCEPT | 85,
+			[0x6f] = SCAN_CODE_TRANSITION_ACCEPT | 86,
+			[0x70] = SCAN_CODE_TRANSITION_ACCEPT | 87,
+			[0x71] = SCAN_CODE_TRANSITION_ACCEPT | 88,
+			[0x72] = SCAN_CODE_TRANSITION_ACCEPT | 89,
+			[0x73] = SCAN_CODE_TRANSITION_ACCEPT | 90,
+			[0x74] = SCAN_CODE_TRANSITION_ACCEPT | 91,
+			[0x75] = SCAN_CODE_TRANSITION_ACCEPT | 92,
+			[0x76] = SCAN_CODE_TRANSITION_ACCEPT | 93,
+			[0x77] = SCAN_CODE_TRANSITION_ACCEPT | 94,
+			[0x79] = SCAN_CODE_TRANSITION_ACCEPT | 95,
+			[0x7a] = SCAN_CODE_TRANSITION_ACCEPT | 96,
+			[0x7c] = SCAN_CODE_TRANSITION_ACCEPT | 97,
+			[0x7d] = SCAN_CODE_TRANSITION_ACCEPT | 98,
+			[0x7e] = SCAN_CODE_TRANSITION_ACCEPT | 99,
+			[0x84] = SCAN_CODE_TRANSITION_ACCEPT | 100,
+			[0x8b] = SCAN_CODE_TRANSITION_ACCEPT | 101,
+			[0x8c] = SCAN_CODE_TRANSITION_ACCEPT | 102,
+			[0x8d] = SCAN_CODE_TRANSITION_ACCEPT | 103,
+		},
+	},
+	.states_len = 1,
+};
+
+const struct scan_code_set	scan_code_set_3 = {
+	.keys = scan_code_set_3_keys,
+	.len = sizeof(scan_code_set_3_keys) / sizeof(*scan_code_set_3_keys),
+	.index = &scan_code_set_3_index,
+	.automaton = &scan_code_set_3_automaton,
+	.break_prefix = 0xf0,
+};
+
+#endif /* __SCAN_CODE_TABLES_H__ */
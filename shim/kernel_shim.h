@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: GPL-2.0
+#ifndef __KERNEL_SHIM_H__
+# define __KERNEL_SHIM_H__
+
+/*
+  Just enough of the kernel API to build the driver sources in userspace, see the Makefile alongside
+  which builds them into libkeyboard_driver.a for the unit tests, the benchmarks and the replay engine.
+  printk() only prints if SHIM_PRINTK is defined, the decoder logs from its hot path.
+ */
+
+# include <stdbool.h>
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <errno.h>
+# include <stddef.h>
+# include <linux/types.h>
+
+// The kernel's fixed width types, uint64_t is unsigned long long there
+typedef __u8	uint8_t;
+typedef __u16	uint16_t;
+typedef __u32	uint32_t;
+typedef __u64	uint64_t;
+typedef __u8	u8;
+typedef __u16	u16;
+typedef __u32	u32;
+typedef __u64	u64;
+
+# define KERN_INFO ""
+# define KERN_WARNING ""
+# ifdef SHIM_PRINTK
+#  define printk(...) fprintf(stderr, __VA_ARGS__)
+# else
+#  define printk(...) ((void)0)
+# endif
+# define printk_ratelimited printk
+
+# define WARN_ON(condition) ({					\
+		bool __warned = !!(condition);				\
+		if (__warned)						\
+			fprintf(stderr, "%s:%d WARN_ON(%s)\n", __FILE__, __LINE__, #condition); \
+		__warned;						\
+	})
+
+# define container_of(ptr, type, member) ((type *)((char *)(ptr) - offsetof(type, member)))
+
+# define MAX_ERRNO 4095
+# define IS_ERR(ptr) ((unsigned long)(ptr) >= (unsigned long)-MAX_ERRNO)
+# define PTR_ERR(ptr) ((long)(ptr))
+# define ERR_PTR(error) ((void *)(long)(error))
+
+# define min(a, b) ((a) < (b) ? (a) : (b))
+# define max(a, b) ((a) > (b) ? (a) : (b))
+# define min_t(type, a, b) min((type)(a), (type)(b))
+# define max_t(type, a, b) max((type)(a), (type)(b))
+
+# define READ_ONCE(x) __atomic_load_n(&(x), __ATOMIC_RELAXED)
+# define WRITE_ONCE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELAXED)
+# define smp_load_acquire(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+# define smp_store_release(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+# define smp_rmb() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+# define smp_wmb() __atomic_thread_fence(__ATOMIC_RELEASE)
+
+# define NSEC_PER_SEC 1000000000ULL
+# define U16_MAX ((__u16)~0U)
+# define U64_MAX (~0ULL)
+
+# define PAGE_SIZE 4096UL
+# define PAGE_ALIGN(x) (((x) + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1))
+
+# define VM_WRITE 0x00000002UL
+# define VM_MAYWRITE 0x00000020UL
+
+struct vm_area_struct {
+	unsigned long	vm_pgoff;
+	unsigned long	vm_flags;
+};
+
+static inline void	vm_flags_clear(struct vm_area_struct *vma, unsigned long flags)
+{
+	vma->vm_flags &= ~flags;
+}
+
+static inline unsigned long	roundup_pow_of_two(unsigned long n)
+{
+	unsigned long	r = 1;
+
+	while (r < n)
+		r <<= 1;
+	return r;
+}
+
+static inline void	*vmalloc_user(unsigned long size)
+{
+	void	*area;
+
+	if (posix_memalign(&area, PAGE_SIZE, size))
+		return NULL;
+	return memset(area, 0, size);
+}
+
+static inline void	*vmalloc(unsigned long size)
+{
+	void	*area;
+
+	if (posix_memalign(&area, PAGE_SIZE, size))
+		return NULL;
+	return area;
+}
+
+static inline void	vfree(const void *area)
+{
+	free((void *)area);
+}
+
+static inline int	remap_vmalloc_range(struct vm_area_struct *vma, void *addr, unsigned long pgoff)
+{
+	(void)vma;
+	(void)addr;
+	(void)pgoff;
+	return 0;
+}
+
+#endif /* __KERNEL_SHIM_H__ */
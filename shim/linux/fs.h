@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: GPL-2.0
+#ifndef __SHIM_FS_H__
+# define __SHIM_FS_H__
+
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/stat.h>
+# include "../kernel_shim.h"
+
+/*
+  Files of the kernel as file descriptors, for the log to be written to actual files
+ */
+
+# ifndef O_LARGEFILE
+#  define O_LARGEFILE 0
+# endif
+
+struct inode {
+	loff_t	i_size;
+};
+
+struct file {
+	int		fd;
+	struct inode	inode;
+};
+
+static inline struct file	*filp_open(const char *path, int flags, unsigned int mode)
+{
+	struct file	*file = malloc(sizeof(*file));
+
+	if (file == NULL)
+		return ERR_PTR(-ENOMEM);
+	file->fd = open(path, flags, mode);
+	if (file->fd < 0) {
+		free(file);
+		return ERR_PTR(-errno);
+	}
+	return file;
+}
+
+static inline int	filp_close(struct file *file, void *id)
+{
+	int	ret = close(file->fd);
+
+	(void)id;
+	free(file);
+	return ret;
+}
+
+static inline struct inode	*file_inode(struct file *file)
+{
+	struct stat	st;
+
+	file->inode.i_size = fstat(file->fd, &st) ? 0 : st.st_size;
+	return &file->inode;
+}
+
+static inline loff_t	i_size_read(const struct inode *inode)
+{
+	return inode->i_size;
+}
+
+static inline ssize_t	kernel_write(struct file *file, const void *buf, size_t count, loff_t *pos)
+{
+	ssize_t	ret = pwrite(file->fd, buf, count, *pos);
+
+	if (ret < 0)
+		return -errno;
+	*pos += ret;
+	return ret;
+}
+
+static inline int	vfs_fsync(struct file *file, int datasync)
+{
+	return datasync ? fdatasync(file->fd) : fsync(file->fd);
+}
+
+#endif /* __SHIM_FS_H__ */
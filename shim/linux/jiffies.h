@@ -0,0 +1,13 @@
+// SPDX-License-Identifier: GPL-2.0
+#ifndef __SHIM_JIFFIES_H__
+# define __SHIM_JIFFIES_H__
+
+# include "../kernel_shim.h"
+
+// A jiffy per millisecond
+static inline unsigned long	msecs_to_jiffies(unsigned int ms)
+{
+	return ms;
+}
+
+#endif /* __SHIM_JIFFIES_H__ */
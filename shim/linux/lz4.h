@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: GPL-2.0
+#ifndef __SHIM_LZ4_H__
+# define __SHIM_LZ4_H__
+
+# include "../kernel_shim.h"
+# include <lz4.h>
+
+/*
+  The kernel flavour of LZ4_compress_default(), whose state is passed by the caller, over liblz4
+ */
+
+# define LZ4_MEM_COMPRESS ((size_t)LZ4_sizeofState())
+
+static inline int	shim_lz4_compress_default(const char *src, char *dst, int size, int max_size, void *workmem)
+{
+	return LZ4_compress_fast_extState(workmem, src, dst, size, max_size, 1);
+}
+
+# define LZ4_compress_default shim_lz4_compress_default
+
+#endif /* __SHIM_LZ4_H__ */
@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: GPL-2.0
+#ifndef __SHIM_SLAB_H__
+# define __SHIM_SLAB_H__
+
+# include <stdarg.h>
+# include "../kernel_shim.h"
+
+# define GFP_KERNEL 0
+
+static inline void	*kmalloc(size_t size, int flags)
+{
+	(void)flags;
+	return malloc(size);
+}
+
+static inline void	*kmalloc_array(size_t n, size_t size, int flags)
+{
+	(void)flags;
+	return n != 0 && size > (size_t)-1 / n ? NULL : malloc(n * size);
+}
+
+static inline void	kfree(const void *p)
+{
+	free((void *)p);
+}
+
+__attribute__((format(printf, 2, 3)))
+static inline char	*kasprintf(int flags, const char *format, ...)
+{
+	va_list	ap;
+	char	*s;
+	int	len;
+
+	(void)flags;
+	va_start(ap, format);
+	len = vsnprintf(NULL, 0, format, ap);
+	va_end(ap);
+	s = len < 0 ? NULL : malloc(len + 1);
+	if (s == NULL)
+		return NULL;
+	va_start(ap, format);
+	vsnprintf(s, len + 1, format, ap);
+	va_end(ap);
+	return s;
+}
+
+#endif /* __SHIM_SLAB_H__ */
@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: GPL-2.0
+#ifndef __SHIM_TRACEPOINT_H__
+# define __SHIM_TRACEPOINT_H__
+
+# include "../kernel_shim.h"
+
+/*
+  Tracepoints are compiled out, each trace_<event>() does nothing
+ */
+
+# define TP_PROTO(...) __VA_ARGS__
+# define TP_ARGS(...) __VA_ARGS__
+# define TRACE_DEFINE_ENUM(a)
+
+# define SHIM_TRACE_STUB(name, ...)						\
+	_Pragma("GCC diagnostic push")						\
+	_Pragma("GCC diagnostic ignored \"-Wunused-parameter\"")		\
+	static inline void	trace_##name(__VA_ARGS__) {}			\
+	static inline bool	trace_##name##_enabled(void) { return false; }	\
+	_Pragma("GCC diagnostic pop")
+
+# define TRACE_EVENT(name, proto, ...) SHIM_TRACE_STUB(name, proto)
+# define DECLARE_EVENT_CLASS(name, ...)
+# define DEFINE_EVENT(class, name, proto, ...) SHIM_TRACE_STUB(name, proto)
+
+#endif /* __SHIM_TRACEPOINT_H__ */
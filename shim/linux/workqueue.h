@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: GPL-2.0
+#ifndef __SHIM_WORKQUEUE_H__
+# define __SHIM_WORKQUEUE_H__
+
+# include "../kernel_shim.h"
+
+/*
+  No worker thread: a work queued without delay runs right away in the caller,
+  a delayed one only runs once it is queued again without delay.
+ */
+
+struct work_struct;
+typedef void	(*work_func_t)(struct work_struct *work);
+
+struct work_struct {
+	work_func_t	func;
+};
+
+struct delayed_work {
+	struct work_struct	work;
+};
+
+struct workqueue_struct;
+# define system_unbound_wq ((struct workqueue_struct *)NULL)
+
+# define INIT_DELAYED_WORK(dwork, f) ((dwork)->work.func = (f))
+
+static inline struct delayed_work	*to_delayed_work(struct work_struct *work)
+{
+	return container_of(work, struct delayed_work, work);
+}
+
+static inline bool	mod_delayed_work(struct workqueue_struct *wq, struct delayed_work *dwork, unsigned long delay)
+{
+	(void)wq;
+	if (delay == 0)
+		dwork->work.func(&dwork->work);
+	return false;
+}
+
+static inline bool	queue_delayed_work(struct workqueue_struct *wq, struct delayed_work *dwork, unsigned long delay)
+{
+	return mod_delayed_work(wq, dwork, delay);
+}
+
+static inline bool	cancel_delayed_work_sync(struct delayed_work *dwork)
+{
+	(void)dwork;
+	return false;
+}
+
+#endif /* __SHIM_WORKQUEUE_H__ */
@@ -0,0 +1,642 @@
+// SPDX-License-Identifier: GPL-2.0
+#include "ps2_keyboard_state.h"
+#include "key_entry_ring.h"
+#include "key_entry_text.h"
+#include "key_entry_filter.h"
+#include "key_entry_log.h"
+#include "log_reader.h"
+#include "ps2_replay.h"
+
+/*
+  Unit tests of the decoder, of the ring, of the log and of the replay, built against libkeyboard_driver.a,
+  the log reader and the replay.
+  Every failed check is reported, the exit status is the number of failed tests.
+ */
+
+static unsigned int	failed_checks;
+
+# define CHECK(condition, format, ...) do {				\
+		if (!(condition)) {					\
+			fprintf(stderr, "%s:%d %s: " format "\n", __FILE__, __LINE__, #condition __VA_OPT__(,) __VA_ARGS__); \
+			failed_checks++;				\
+		}							\
+	} while (0)
+
+static const struct scan_code_set *const	sets[] = {
+	&scan_code_set_1,
+	&scan_code_set_2,
+	&scan_code_set_3,
+};
+
+static void	init_state(struct ps2_keyboard_state *state, const struct scan_code_set *set)
+{
+	memset(state, 0, sizeof(*state));
+	state->scan_code_set = set;
+	ps2_reset_pending_code(state);
+}
+
+/*
+  Feeds the bytes of `code` to the decoder, returns the key it completed on the last one, NULL otherwise.
+  The pending code is reset afterwards, as keyboard_decode() does.
+ */
+static const struct scan_key_code	*decode(struct ps2_keyboard_state *state, uint64_t code)
+{
+	uint8_t			len = scan_key_code_len(code);
+	enum ps2_decode_status	status = PS2_DECODE_INVALID;
+	const struct scan_key_code	*key;
+	uint8_t			n;
+
+	for (n = 0; n < len; n++) {
+		status = ps2_decode_byte(state, (code >> ((len - n - 1U) * 8U)) & 0xFF);
+		if (status != PS2_DECODE_PENDING)
+			break;
+	}
+	key = n == len - 1U && status == PS2_DECODE_COMPLETE ? ps2_find_scan_key_code(state) : NULL;
+	ps2_reset_pending_code(state);
+	return key;
+}
+
+/*
+  The index and the automaton must agree with the linear lookup of the set
+ */
+static void	test_lookups(void)
+{
+	const struct scan_code_set	*set;
+	struct ps2_keyboard_state	state;
+	const struct scan_key_code	*key;
+	uint64_t			code;
+	unsigned int			s;
+	uint64_t			i;
+
+	for (s = 0; s < sizeof(sets) / sizeof(*sets); s++) {
+		set = sets[s];
+		CHECK(check_scan_code_index(set), "set %u", s + 1);
+		CHECK(check_scan_code_automaton(set), "set %u", s + 1);
+		for (i = 0; i < set->len; i++) {
+			code = set->keys[i].code;
+			key = find_scan_key_code(set->keys, set->len, code);
+			CHECK(find_scan_key_code_indexed(set->index, code) == key, "set %u code %#llx", s + 1, code);
+			init_state(&state, set);
+			CHECK(decode(&state, code) == key, "set %u code %#llx", s + 1, code);
+		}
+		// Codes which are not in the set, single and extended ones
+		for (code = 0; code < 0x100; code++) {
+			key = find_scan_key_code(set->keys, set->len, code);
+			CHECK(find_scan_key_code_indexed(set->index, code) == key, "set %u code %#llx", s + 1, code);
+			key = find_scan_key_code(set->keys, set->len, 0xE000 | code);
+			CHECK(find_scan_key_code_indexed(set->index, 0xE000 | code) == key,
+			      "set %u code %#llx", s + 1, 0xE000 | code);
+		}
+	}
+}
+
+static void	test_decoder(void)
+{
+	struct ps2_keyboard_state	state;
+	const struct scan_key_code	*key;
+
+	init_state(&state, &scan_code_set_1);
+
+	// 0xE0 is only a prefix, and nothing follows 0xE0 0xE0
+	CHECK(ps2_decode_byte(&state, 0xE0) == PS2_DECODE_PENDING, "");
+	CHECK(ps2_decode_byte(&state, 0xE0) == PS2_DECODE_INVALID, "");
+	ps2_reset_pending_code(&state);
+
+	// Right control, on two bytes
+	CHECK(ps2_decode_byte(&state, 0xE0) == PS2_DECODE_PENDING, "");
+	CHECK(ps2_decode_byte(&state, 0x1D) == PS2_DECODE_COMPLETE, "");
+	key = ps2_find_scan_key_code(&state);
+	CHECK(key != NULL && key->code == 0xE01D && key->state == PRESSED, "");
+	CHECK(state.flags == PS2_RIGHT_CTRL_ACTIVE, "flags %#hx", state.flags);
+	ps2_reset_pending_code(&state);
+	CHECK(decode(&state, 0xE09D) != NULL && state.flags == 0, "flags %#hx", state.flags);
+
+	// Print screen pressed, on four bytes
+	key = decode(&state, 0xE02AE037);
+	CHECK(key != NULL && key->code == 0xE02AE037, "");
+
+	// The pressed and released codes of a key share its id
+	key = decode(&state, 0x1E);
+	CHECK(key != NULL && key->state == PRESSED, "");
+	CHECK(key == NULL || key->id == decode(&state, 0x9E)->id, "");
+}
+
+static void	test_modifiers(void)
+{
+	struct ps2_keyboard_state	state;
+	struct keyboard_driver_record	record;
+	const struct scan_key_code	*key;
+
+	init_state(&state, &scan_code_set_1);
+
+	// 'a', then with left shift held
+	key = decode(&state, 0x1E);
+	ps2_fill_record(&state, key, &record);
+	CHECK(record.ascii_value == 'a' && record.modifiers == 0, "%c %#hx", record.ascii_value, record.modifiers);
+	decode(&state, 0x2A);
+	CHECK(state.flags == PS2_LEFT_SHIFT_ACTIVE, "flags %#hx", state.flags);
+	key = decode(&state, 0x1E);
+	ps2_fill_record(&state, key, &record);
+	CHECK(record.ascii_value == 'A', "%c", record.ascii_value);
+	key = decode(&state, 0x02);
+	CHECK(ps2_key_name_with_modifiers(&state, key) == '!', "");
+	decode(&state, 0xAA);
+	CHECK(state.flags == 0, "flags %#hx", state.flags);
+
+	// Caps lock toggles on each press, and not on its release
+	decode(&state, 0x3A);
+	decode(&state, 0xBA);
+	CHECK(state.flags == PS2_CAPSLOCK_ACTIVE, "flags %#hx", state.flags);
+	decode(&state, 0x3A);
+	CHECK(state.flags == 0, "flags %#hx", state.flags);
+	decode(&state, 0xBA);
+
+	// but not on the typematic repeats of a held press
+	decode(&state, 0x3A);
+	decode(&state, 0x3A);
+	CHECK(state.flags == PS2_CAPSLOCK_ACTIVE, "flags %#hx", state.flags);
+	decode(&state, 0xBA);
+	CHECK(state.flags == PS2_CAPSLOCK_ACTIVE, "flags %#hx", state.flags);
+	decode(&state, 0x3A);
+	CHECK(state.flags == 0, "flags %#hx", state.flags);
+}
+
+/*
+  Sets 2 and 3 only list the make codes, their break codes go through the break prefix of the decoder
+ */
+static void	test_break_prefix(void)
+{
+	struct ps2_keyboard_state	state;
+	struct keyboard_driver_record	record;
+	const struct scan_key_code	*key;
+
+	init_state(&state, &scan_code_set_2);
+
+	// 'a' pressed, then released
+	key = decode(&state, 0x1C);
+	CHECK(key != NULL && key->state == PRESSED, "");
+	CHECK(ps2_decode_byte(&state, 0xF0) == PS2_DECODE_PENDING, "");
+	CHECK(ps2_decode_byte(&state, 0x1C) == PS2_DECODE_COMPLETE, "");
+	key = ps2_find_scan_key_code(&state);
+	CHECK(key != NULL, "");
+	if (key != NULL) {
+		ps2_fill_record(&state, key, &record);
+		CHECK(record.state == RELEASED && record.code == 0xF01C && record.ascii_value == 'a',
+		      "%u %#llx %c", record.state, record.code, record.ascii_value);
+	}
+	ps2_reset_pending_code(&state);
+
+	// Right control, the break prefix comes after 0xE0
+	decode(&state, 0xE014);
+	CHECK(state.flags == PS2_RIGHT_CTRL_ACTIVE, "flags %#hx", state.flags);
+	CHECK(decode(&state, 0xE0F014) != NULL && state.flags == 0, "flags %#hx", state.flags);
+
+	// Never twice in a row
+	CHECK(ps2_decode_byte(&state, 0xF0) == PS2_DECODE_PENDING, "");
+	CHECK(ps2_decode_byte(&state, 0xF0) == PS2_DECODE_INVALID, "");
+	ps2_reset_pending_code(&state);
+
+	// Print screen has a break code of its own, pause has none but holds 0xF0 bytes
+	key = decode(&state, 0xE0F07CE0F012);
+	CHECK(key != NULL && key->state == RELEASED, "");
+	key = decode(&state, 0xE11477E1F014F077);
+	CHECK(key != NULL && key->state == PRESSED && key->code == 0xE11477E1F014F077, "");
+
+	// Same key ids as set 1
+	key = decode(&state, 0x1C);
+	CHECK(key != NULL && key->id == find_scan_key_code(scan_code_set_1.keys, scan_code_set_1.len, 0x1E)->id, "");
+
+	init_state(&state, &scan_code_set_3);
+	decode(&state, 0x12);
+	CHECK(state.flags == PS2_LEFT_SHIFT_ACTIVE, "flags %#hx", state.flags);
+	decode(&state, 0xF012);
+	CHECK(state.flags == 0, "flags %#hx", state.flags);
+
+	// Set 1 has no break prefix
+	init_state(&state, &scan_code_set_1);
+	CHECK(ps2_decode_byte(&state, 0xF0) == PS2_DECODE_INVALID, "");
+}
+
+/*
+  The text formatter must render the same lines as the printf() format of the text mode
+ */
+static void	test_text(void)
+{
+	static const uint64_t		codes[] = { 0x1E, 0x9E, 0xF01C, 0xE0F07CE0F012, 0xE11477E1F014F077, 0x0, 0x1 };
+	struct keyboard_driver_record	record;
+	struct key_entry_text		text;
+	char				expected[KEY_ENTRY_TEXT_MAX_LINE + 1];
+	char				line[KEY_ENTRY_TEXT_MAX_LINE];
+	const char			*name;
+	uint64_t			date;
+	size_t				len;
+	unsigned int			i;
+
+	key_entry_text_setup();
+	key_entry_text_init(&text, 1700000000ULL * NSEC_PER_SEC);
+	memset(&record, 0, sizeof(record));
+	for (i = 0; i < 4096; i++) {
+		// Every key id, across second, hour and day boundaries, and back in time once
+		record.timestamp = i == 2048 ? 0 : i * 37ULL * NSEC_PER_SEC / 8U;
+		record.key_id = i;
+		record.code = codes[i % (sizeof(codes) / sizeof(*codes))];
+		record.state = i % 2U;
+		record.flags = i % 5U == 4U ? KEYBOARD_DRIVER_RECORD_REPEAT : 0;
+		record.repeats = i % 7U == 6U ? 65535U : i;
+		date = (record.timestamp + text.realtime_offset) / NSEC_PER_SEC;
+		name = scan_code_key_names[record.key_id];
+		len = snprintf(expected, sizeof(expected), "%02lld:%02lld:%02lld %s(%#02llx) ",
+			       (long long)(date / 3600) % 24, (long long)(date / 60) % 60, (long long)date % 60,
+			       name ? name : "unknown", record.code);
+		if (record.flags & KEYBOARD_DRIVER_RECORD_REPEAT)
+			snprintf(expected + len, sizeof(expected) - len, "Repeated %u\n", record.repeats);
+		else
+			snprintf(expected + len, sizeof(expected) - len, "%s\n",
+				 record.state == RELEASED ? "Released" : "Pressed");
+		len = key_entry_text_format(&text, &record, line);
+		CHECK(len == strlen(expected) && !memcmp(line, expected, len), "record %u: %.*s", i, (int)len, line);
+	}
+}
+
+static void	test_filter(void)
+{
+	struct keyboard_driver_filter	source;
+	struct keyboard_driver_record	record;
+	struct key_entry_filter		filter;
+
+	memset(&filter, 0, sizeof(filter));
+	memset(&record, 0, sizeof(record));
+	record.key_id = 70;
+	record.state = PRESSED;
+	record.modifiers = PS2_LEFT_SHIFT_ACTIVE | PS2_NUM_LOCK_ACTIVE;
+	record.timestamp = 1000;
+	CHECK(key_entry_filter_match(&filter, &record), "");
+
+	// Presses of key 70 with left shift held and no control, from 1000 on
+	memset(&source, 0, sizeof(source));
+	source.states = KEYBOARD_DRIVER_FILTER_PRESSED;
+	source.key_ids[1] = 1ULL << 6;
+	source.modifiers_mask = PS2_LEFT_SHIFT_ACTIVE | PS2_LEFT_CTRL_ACTIVE;
+	source.modifiers_value = PS2_LEFT_SHIFT_ACTIVE;
+	source.from = 1000;
+	CHECK(key_entry_filter_compile(&filter, &source) == 0, "");
+	CHECK(key_entry_filter_match(&filter, &record), "");
+	record.state = RELEASED;
+	CHECK(!key_entry_filter_match(&filter, &record), "");
+	record.state = PRESSED;
+	record.key_id = 71;
+	CHECK(!key_entry_filter_match(&filter, &record), "");
+	record.key_id = 70;
+	record.modifiers |= PS2_LEFT_CTRL_ACTIVE;
+	CHECK(!key_entry_filter_match(&filter, &record), "");
+	record.modifiers &= ~PS2_LEFT_CTRL_ACTIVE;
+	record.timestamp = 999;
+	CHECK(!key_entry_filter_match(&filter, &record), "");
+	record.timestamp = U64_MAX;
+	CHECK(key_entry_filter_match(&filter, &record), "");
+
+	// Bounded window
+	source.to = 2000;
+	CHECK(key_entry_filter_compile(&filter, &source) == 0, "");
+	CHECK(!key_entry_filter_match(&filter, &record), "");
+	record.timestamp = 2000;
+	CHECK(key_entry_filter_match(&filter, &record), "");
+
+	// Invalid filters leave the installed one as it is
+	source.from = 3000;
+	CHECK(key_entry_filter_compile(&filter, &source) == -EINVAL, "");
+	source.from = 0;
+	source.states = 1U << 2U;
+	CHECK(key_entry_filter_compile(&filter, &source) == -EINVAL, "");
+	source.states = KEYBOARD_DRIVER_FILTER_PRESSED;
+	source.modifiers_value = PS2_RIGHT_ALT_ACTIVE;
+	CHECK(key_entry_filter_compile(&filter, &source) == -EINVAL, "");
+	CHECK(key_entry_filter_match(&filter, &record), "");
+
+	key_entry_filter_disable(&filter);
+	record.key_id = 0;
+	CHECK(key_entry_filter_match(&filter, &record), "");
+}
+
+/*
+  Decodes `code` at `timestamp` and coalesces its record as keyboard_decode() does, returns true if it was a repeat
+ */
+static bool	coalesce(struct ps2_keyboard_state *state, uint64_t code, uint64_t timestamp,
+			 struct keyboard_driver_record *run)
+{
+	struct keyboard_driver_record	record;
+	uint8_t				len = scan_key_code_len(code);
+
+	while (len-- != 0)
+		ps2_decode_byte(state, code >> (len * 8U));
+	ps2_fill_record(state, ps2_find_scan_key_code(state), &record);
+	ps2_reset_pending_code(state);
+	record.timestamp = timestamp;
+	return ps2_coalesce_repeat(state, &record, run);
+}
+
+static void	test_repeats(void)
+{
+	struct ps2_keyboard_state	state;
+	struct keyboard_driver_record	run;
+	unsigned int			i;
+
+	init_state(&state, &scan_code_set_1);
+
+	// A press alone is not a run
+	CHECK(!coalesce(&state, 0x1E, 10, &run) && run.repeats == 0, "");
+	CHECK(!coalesce(&state, 0x9E, 20, &run) && run.repeats == 0, "");
+
+	// 'a' held with shift, its run ends with its release
+	coalesce(&state, 0x2A, 30, &run);
+	CHECK(!coalesce(&state, 0x1E, 40, &run), "");
+	for (i = 1; i <= 3; i++)
+		CHECK(coalesce(&state, 0x1E, 40 + i, &run) && run.repeats == 0, "repeat %u", i);
+	CHECK(!coalesce(&state, 0x9E, 50, &run), "");
+	CHECK(run.repeats == 3 && run.flags == KEYBOARD_DRIVER_RECORD_REPEAT && run.timestamp == 43
+		&& run.state == PRESSED && run.code == 0x1E && run.ascii_value == 'A'
+		&& run.modifiers == PS2_LEFT_SHIFT_ACTIVE, "repeats %u timestamp %llu", run.repeats, run.timestamp);
+	CHECK(!coalesce(&state, 0x1E, 60, &run) && run.repeats == 0, "");
+
+	// Another key pressed ends the run, the first key does not repeat anymore even though it is still held
+	coalesce(&state, 0x1E, 61, &run);
+	CHECK(!coalesce(&state, 0x30, 70, &run) && run.repeats == 1 && run.timestamp == 61, "");
+	CHECK(!coalesce(&state, 0x1E, 71, &run) && run.repeats == 0, "");
+
+	// Releasing another key ends the run but not the hold
+	coalesce(&state, 0x1E, 72, &run);
+	CHECK(!coalesce(&state, 0xB0, 80, &run) && run.repeats == 1, "");
+	CHECK(coalesce(&state, 0x1E, 81, &run) && run.repeats == 0, "");
+
+	// A run is cut every U16_MAX repeats, by the repeat which starts the next one
+	for (i = 2; i <= U16_MAX; i++)
+		coalesce(&state, 0x1E, 100 + i, &run);
+	CHECK(coalesce(&state, 0x1E, 100 + i, &run) && run.repeats == U16_MAX && run.timestamp == 99 + i, "");
+	CHECK(!coalesce(&state, 0x9E, 101 + i, &run) && run.repeats == 1 && run.timestamp == 100 + i, "");
+
+	// Break prefixed releases end the hold as well
+	init_state(&state, &scan_code_set_2);
+	coalesce(&state, 0x1C, 10, &run);
+	coalesce(&state, 0x1C, 11, &run);
+	CHECK(!coalesce(&state, 0xF01C, 20, &run) && run.repeats == 1 && run.code == 0x1C, "");
+	CHECK(!coalesce(&state, 0x1C, 30, &run) && run.repeats == 0, "");
+}
+
+/*
+  A coalesced run of Caps Lock, as recorded by the driver, is replayed as is and does not toggle the lock again
+ */
+static void	test_replay(void)
+{
+	struct keyboard_driver_record	records[4];
+	struct keyboard_driver_record	record;
+	struct ps2_replay		replay;
+	const uint64_t			codes[] = { 0x3A, 0x3A, 0xBA, 0x1E };
+	unsigned int			i;
+
+	memset(records, 0, sizeof(records));
+	for (i = 0; i < 4; i++) {
+		records[i].timestamp = 10 * i;
+		records[i].code = codes[i];
+		records[i].modifiers = PS2_CAPSLOCK_ACTIVE;
+	}
+	records[1].flags = KEYBOARD_DRIVER_RECORD_REPEAT;
+	records[1].repeats = 7;
+	CHECK(ps2_replay_init(&replay, PS2_REPLAY_RECORDS, &scan_code_set_1, (const uint8_t *)records,
+			      sizeof(records), 2) == 0, "");
+	for (i = 0; ps2_replay_next(&replay, &record); i++) {
+		CHECK(i < 4 && record.code == codes[i] && record.timestamp == records[i].timestamp
+		      && record.flags == records[i].flags && record.repeats == records[i].repeats
+		      && record.modifiers == PS2_CAPSLOCK_ACTIVE,
+		      "event %u flags %#x repeats %u modifiers %#hx", i, record.flags, record.repeats, record.modifiers);
+	}
+	CHECK(i == 4 && replay.invalid == 0 && replay.mismatches == 0, "%u events %llu mismatches",
+	      i, (unsigned long long)replay.mismatches);
+	CHECK(record.ascii_value == 'A', "%c", record.ascii_value);
+	ps2_replay_destroy(&replay);
+}
+
+static void	push(struct key_entry_ring *ring, uint64_t n)
+{
+	struct keyboard_driver_record	record;
+	uint64_t			i;
+
+	memset(&record, 0, sizeof(record));
+	for (i = 0; i < n; i++) {
+		record.timestamp = key_entry_ring_head(ring);
+		key_entry_ring_push(ring, &record);
+	}
+}
+
+static void	test_ring(void)
+{
+	struct key_entry_ring		ring;
+	struct key_entry_cursor		cursor = { 0, 0 };
+	struct keyboard_driver_record	record;
+	struct vm_area_struct		vma;
+	uint64_t			i;
+
+	CHECK(key_entry_ring_init(&ring, 16, 16, KEY_ENTRY_RING_DROP_OLDEST) == 0, "");
+	push(&ring, 10);
+	CHECK(key_entry_ring_available(&ring, 0) == 10, "");
+	for (i = 0; i < 10; i++)
+		CHECK(key_entry_ring_read(&ring, &cursor, &record) && record.timestamp == i, "record %llu", i);
+	CHECK(!key_entry_ring_read(&ring, &cursor, &record), "");
+
+	// The reader is overtaken, the evicted records are counted as lost
+	push(&ring, 20);
+	CHECK(key_entry_ring_oldest(&ring) == 14, "oldest %llu", key_entry_ring_oldest(&ring));
+	CHECK(key_entry_ring_read(&ring, &cursor, &record) && record.timestamp == 14, "");
+	CHECK(cursor.lost == 4, "lost %llu", cursor.lost);
+	CHECK(ring.evicted == 14, "evicted %llu", ring.evicted);
+
+	// Contiguous runs stop at the end of the records array
+	CHECK(key_entry_ring_contiguous(&ring, 15) == 1, "");
+	CHECK(key_entry_ring_contiguous(&ring, 16) == 14, "");
+	key_entry_ring_destroy(&ring);
+
+	// Past the limit, new records are dropped instead
+	CHECK(key_entry_ring_init(&ring, 16, 8, KEY_ENTRY_RING_DROP_NEWEST) == 0, "");
+	push(&ring, 8);
+	CHECK(key_entry_ring_full(&ring), "");
+	memset(&record, 0, sizeof(record));
+	CHECK(!key_entry_ring_push(&ring, &record), "");
+	CHECK(ring.dropped == 1 && key_entry_ring_head(&ring) == 8, "");
+	key_entry_ring_reclaim(&ring, 4);
+	CHECK(!key_entry_ring_full(&ring) && key_entry_ring_oldest(&ring) == 4, "");
+	CHECK(key_entry_ring_push(&ring, &record), "");
+
+	// Userspace only maps the ring read only, for good
+	memset(&vma, 0, sizeof(vma));
+	vma.vm_flags = VM_WRITE | VM_MAYWRITE;
+	CHECK(key_entry_ring_mmap(&ring, &vma) == -EPERM, "");
+	vma.vm_flags = VM_MAYWRITE;
+	CHECK(key_entry_ring_mmap(&ring, &vma) == 0 && !(vma.vm_flags & VM_MAYWRITE), "");
+	key_entry_ring_destroy(&ring);
+}
+
+#define LOG_TEST_RECORDS 10000U
+#define LOG_TEST_BATCH 64U
+#define LOG_TEST_MAX_BLOCKS (LOG_TEST_RECORDS / LOG_TEST_BATCH + 1U)
+#define LOG_TEST_REALTIME (1700000000ULL * NSEC_PER_SEC)
+
+struct	log_check {
+	const struct keyboard_driver_record	*records;
+	uint64_t				decoded;
+	uint64_t				mismatches;
+};
+
+/*
+  Entries are decoded in order, as they were pushed, dated by the wall clock
+ */
+static int	check_log_entry(void *ctx, __u64 seq, const struct keyboard_driver_record *record)
+{
+	struct log_check		*check = ctx;
+	struct keyboard_driver_record	expected;
+
+	if (seq != check->decoded || seq >= LOG_TEST_RECORDS) {
+		check->mismatches++;
+		return -1;
+	}
+	expected = check->records[seq];
+	expected.timestamp += LOG_TEST_REALTIME;
+	if (memcmp(record, &expected, sizeof(expected)) != 0)
+		check->mismatches++;
+	check->decoded++;
+	return 0;
+}
+
+/*
+  Records covering every entry flag and varint size, with timestamps going backwards now and then.
+  The codes of the second half are random, so that some blocks do not compress.
+ */
+static void	build_log_records(struct keyboard_driver_record *records)
+{
+	unsigned int	seed = 42;
+	uint64_t	timestamp = 1000;
+	unsigned int	i;
+
+	memset(records, 0, LOG_TEST_RECORDS * sizeof(*records));
+	for (i = 0; i < LOG_TEST_RECORDS; i++) {
+		records[i].timestamp = timestamp;
+		timestamp = i % 97U == 96U ? timestamp - 700U : timestamp + 1000U + rand_r(&seed) % 1000U;
+		if (i < LOG_TEST_RECORDS / 2U) {
+			records[i].code = 0x1E + i % 4U;
+			records[i].key_id = 30 + i % 4U;
+		} else {
+			records[i].code = (uint64_t)rand_r(&seed) << 33U ^ (uint64_t)rand_r(&seed) << 2U;
+			records[i].key_id = rand_r(&seed);
+		}
+		records[i].modifiers = (i / 10U) % 4U == 3U ? 0xFFFF : (i / 10U) % 4U;
+		records[i].ascii_value = i % 3U ? 'a' + i % 26U : 0;
+		records[i].state = i % 2U;
+		if (i % 5U == 0) {
+			records[i].state = PRESSED;
+			records[i].flags = KEYBOARD_DRIVER_RECORD_REPEAT;
+			records[i].repeats = i == 0 ? U16_MAX : i % 300U + 1U;
+		}
+	}
+}
+
+/*
+  Records written by key_entry_log.c are read back by the log reader, and the index finds their blocks
+ */
+static void	test_log(void)
+{
+	static struct keyboard_driver_record	records[LOG_TEST_RECORDS];
+	struct keyboard_driver_log_block	header;
+	uint64_t				last_timestamps[LOG_TEST_MAX_BLOCKS];
+	off_t					offsets[LOG_TEST_MAX_BLOCKS];
+	unsigned int				compressed = 0;
+	unsigned int				blocks = 0;
+	struct log_check			check = { records, 0, 0 };
+	struct key_entry_ring			ring;
+	struct key_entry_log			log;
+	struct log_reader			reader;
+	char					path[] = "/tmp/keyboard_driver_log_XXXXXX";
+	char					index_path[sizeof(path) + 4];
+	uint64_t				from;
+	off_t					offset = 0;
+	unsigned int				b;
+	unsigned int				i;
+	int					fd;
+
+	fd = mkstemp(path);
+	CHECK(fd >= 0, "");
+	if (fd < 0)
+		return;
+	close(fd);
+	snprintf(index_path, sizeof(index_path), "%s.idx", path);
+	build_log_records(records);
+
+	// Written by blocks of LOG_TEST_BATCH entries as the producer kicks the log, the last one as it is destroyed
+	CHECK(key_entry_ring_init(&ring, LOG_TEST_RECORDS, LOG_TEST_RECORDS, KEY_ENTRY_RING_DROP_OLDEST) == 0, "");
+	CHECK(key_entry_log_init(&log, &ring, path, LOG_TEST_BATCH, 1000, KEY_ENTRY_LOG_FSYNC_NEVER, LOG_TEST_REALTIME) == 0,
+	      "");
+	for (i = 0; i < LOG_TEST_RECORDS; i++) {
+		key_entry_ring_push(&ring, &records[i]);
+		key_entry_log_kick(&log);
+	}
+	CHECK(log.written == LOG_TEST_RECORDS - LOG_TEST_RECORDS % LOG_TEST_BATCH, "written %llu", log.written);
+	key_entry_log_destroy(&log);
+	key_entry_ring_destroy(&ring);
+
+	CHECK(log_reader_open(&reader, path) == 0, "");
+	while (blocks < LOG_TEST_MAX_BLOCKS && log_reader_header(&reader, offset, &header) == 0) {
+		CHECK(header.version == KEYBOARD_DRIVER_LOG_VERSION && header.first_seq == check.decoded,
+		      "block %u", blocks);
+		offsets[blocks] = offset;
+		last_timestamps[blocks++] = header.last_timestamp;
+		compressed += !!(header.flags & KEYBOARD_DRIVER_LOG_LZ4);
+		offset += sizeof(header);
+		CHECK(log_reader_decode_block(&reader, &header, offset, &check_log_entry, &check) == 0, "block %u", blocks);
+		offset += header.size;
+	}
+	log_reader_close(&reader);
+	CHECK(check.decoded == LOG_TEST_RECORDS && check.mismatches == 0,
+	      "decoded %llu, %llu mismatches", check.decoded, check.mismatches);
+	CHECK(blocks == LOG_TEST_MAX_BLOCKS, "blocks %u", blocks);
+	CHECK(compressed != 0 && compressed != blocks, "%u compressed blocks out of %u", compressed, blocks);
+
+	// The first block which ends at `from` or later, else the last one
+	for (i = 0; i < blocks; i++) {
+		for (from = last_timestamps[i] - 1; from <= last_timestamps[i] + 1; from++) {
+			for (b = 0; b + 1 < blocks && last_timestamps[b] < from; b++)
+				;
+			CHECK(log_reader_index_lookup(path, from) == offsets[b], "block %u from %llu", i, from);
+		}
+	}
+	CHECK(log_reader_index_lookup(path, U64_MAX) == offsets[blocks - 1], "");
+	unlink(path);
+	unlink(index_path);
+}
+
+static const struct {
+	const char	*name;
+	void		(*run)(void);
+}	tests[] = {
+	{ "lookups", &test_lookups },
+	{ "decoder", &test_decoder },
+	{ "modifiers", &test_modifiers },
+	{ "break_prefix", &test_break_prefix },
+	{ "text", &test_text },
+	{ "filter", &test_filter },
+	{ "repeats", &test_repeats },
+	{ "ring", &test_ring },
+	{ "log", &test_log },
+	{ "replay", &test_replay },
+};
+
+int	main(void)
+{
+	unsigned int	failed = 0;
+	unsigned int	checks;
+	unsigned int	i;
+
+	for (i = 0; i < sizeof(tests) / sizeof(*tests); i++) {
+		checks = failed_checks;
+		tests[i].run();
+		printf("%-12s %s\n", tests[i].name, failed_checks == checks ? "ok" : "FAILED");
+		failed += failed_checks != checks;
+	}
+	return failed;
+}